@@ -1,134 +1,329 @@
-"""
-.. module:: cc3000_tiny
-
-
-***********
-CC3000 Tiny
-***********
-
-This module implements the cc3000 wifi driver with stripped down functionalities for low resource devices. The following funtionalities are missing:
-
-    * wifi network scanning
-    * ping
-    * smart_config
-
-Refer to :mod:`cc3000` for usage info
-
-    """
-
-
-
-
-def auto_init():
-    """
-.. function:: auto_init()        
-
-        Tries to automatically init the CC3000 driver by looking at the device type.
-        The automatic configuration is possible for all the Arduino compatible devices
-        and for the Particle Core.
-
-        Otherwise an exception is raised        
-    """
-    if __defined(LAYOUT,"arduino_uno"):
-        init(SPI0,D10,D5,D3)
-    elif __defined(BOARD,"particle_core"):
-        init(SPI1,D13,D11,D12)
-    else:
-        raise UnsupportedError
-
-def init(spi,nss,wen,irq):
-    """
-.. function:: init(spi,nss,wen,irq)        
-            
-        Tries to init the CC3000 driver. *spi* is the name of the spi driver the CC3000 is connected to.
-        *nss* is the pin used as Chip Select (CS). *wen* is the pin used as Wireless Enable. *irq* is the pin used by
-        the CC3000 to generate an interrupt.
-
-    """
-    _hwinit(spi&0xff,nss,wen,irq)
-    __builtins__.__default_net["wifi"] = __module__
-    __builtins__.__default_net["sock"][0] = __module__ #AF_INET
-
-@native_c("cc3000_init",["csrc/*","csrc/drv/*"],["VBL_SPI","VHAL_SPI","VIPER_CC3000_TINY_DRIVER"])
-def _hwinit(spi,nss,wen,irq):
-    pass
-
-
-@native_c("cc3000_wifi_link",["csrc/*"])
-def link(ssid,sec,password):
-    pass
-
-@native_c("cc3000_wifi_unlink",["csrc/*"])
-def unlink():
-    pass
-
-
-@native_c("cc3000_info",["csrc/*"])
-def link_info():
-    pass
-
-@native_c("cc3000_set_info",["csrc/*"])
-def set_link_info(ip,mask,gw,dns):
-    pass
-
-
-@native_c("cc3000_done",["csrc/*"])
-def done():
-    pass
-
-@native_c("cc3000_socket",["csrc/*"])
-def socket(family,type,proto):
-    pass
-
-@native_c("cc3000_sockopt",["csrc/*"])
-def setsockopt(sock,level,optname,value):
-    pass
-
-@native_c("cc3000_close",["csrc/*"])
-def close(sock):
-    pass
-
-@native_c("cc3000_sendto",["csrc/*"])
-def sendto(sock,buf,addr,flags=0):
-    pass
-
-@native_c("cc3000_send",["csrc/*"])
-def send(sock,buf,flags=0):
-    pass
-
-@native_c("cc3000_sendall",["csrc/*"])
-def sendall(sock,buf,flags=0):
-    pass
-
-
-@native_c("cc3000_recv_into",["csrc/*"])
-def recv_into(sock,buf,bufsize,flags=0,ofs=0):
-    pass
-
-
-@native_c("cc3000_recvfrom_into",["csrc/*"])
-def recvfrom_into(sock,buf,bufsize,flags=0):
-    pass
-
-
-@native_c("cc3000_bind",["csrc/*"])
-def bind(sock,addr):
-    pass
-
-@native_c("cc3000_listen",["csrc/*"])
-def listen(sock,maxlog=2):
-    pass
-
-@native_c("cc3000_accept",["csrc/*"])
-def accept(sock):
-    pass
-
-@native_c("cc3000_connect",["csrc/*"])
-def connect(sock,addr):
-    pass
-
-@native_c("cc3000_resolve",["csrc/*"])
-def gethostbyname(hostname):
-    pass
-
-
+"""
+.. module:: cc3000_tiny
+
+
+***********
+CC3000 Tiny
+***********
+
+This module implements the cc3000 wifi driver with stripped down functionalities for low resource devices. The following funtionalities are missing:
+
+    * wifi network scanning
+    * ping
+    * smart_config
+
+Refer to :mod:`cc3000` for usage info
+
+    """
+
+
+
+
+def auto_init():
+    """
+.. function:: auto_init()        
+
+        Tries to automatically init the CC3000 driver by looking at the device type.
+        The automatic configuration is possible for all the Arduino compatible devices
+        and for the Particle Core.
+
+        Otherwise an exception is raised        
+    """
+    if __defined(LAYOUT,"arduino_uno"):
+        init(SPI0,D10,D5,D3)
+    elif __defined(BOARD,"particle_core"):
+        init(SPI1,D13,D11,D12)
+    else:
+        raise UnsupportedError
+
+def init(spi,nss,wen,irq,fast_boot=False,rejoin=False):
+    """
+.. function:: init(spi,nss,wen,irq,fast_boot=False,rejoin=False)        
+            
+        Tries to init the CC3000 driver. *spi* is the name of the spi driver the CC3000 is connected to.
+        *nss* is the pin used as Chip Select (CS). *wen* is the pin used as Wireless Enable. *irq* is the pin used by
+        the CC3000 to generate an interrupt.
+
+        If *fast_boot* is True the fixed bring-up delays are replaced by waits on the *irq* line, bounded by the
+        datasheet minimums. The time spent in each boot step is returned by :func:`boot_timeline`.
+
+        *rejoin* is ignored by this driver.
+
+    """
+    _hwinit(spi&0xff,nss,wen,irq,1 if fast_boot else 0,1 if rejoin else 0)
+    __builtins__.__default_net["wifi"] = __module__
+    __builtins__.__default_net["sock"][0] = __module__ #AF_INET
+
+@native_c("cc3000_init",["csrc/*","csrc/drv/*"],["VBL_SPI","VHAL_SPI","VIPER_CC3000_TINY_DRIVER"])
+def _hwinit(spi,nss,wen,irq,fast_boot,rejoin):
+    pass
+
+
+def link(ssid,sec,password,bssid=None):
+    if bssid is None:
+        bssid = ""
+    _link(ssid,sec,password,bssid)
+
+@native_c("cc3000_wifi_link",["csrc/*"])
+def _link(ssid,sec,password,bssid):
+    pass
+
+@native_c("cc3000_wifi_unlink",["csrc/*"])
+def unlink():
+    pass
+
+
+@native_c("cc3000_info",["csrc/*"])
+def link_info():
+    pass
+
+@native_c("cc3000_info_stats",["csrc/*"])
+def link_info_stats():
+    pass
+
+@native_c("cc3000_set_info",["csrc/*"])
+def set_link_info(ip,mask,gw,dns):
+    pass
+
+
+# writes back the NVMEM cache before stopping the chip, IOError if that fails
+@native_c("cc3000_done",["csrc/*"])
+def done():
+    pass
+
+# (connect_ms,dhcp_ms,total_ms,warm,cold_ms,warm_ms,warmup_ms): warmup_ms is the
+# resolver priming moved out of link(), paid by the first lookup or sendto()
+@native_c("cc3000_link_stats",["csrc/*"])
+def link_stats():
+    pass
+
+LINK_IDLE = 0
+LINK_ASSOCIATING = 1
+LINK_ASSOCIATED = 2
+LINK_IP_READY = 3
+LINK_LOST = 4
+
+@native_c("cc3000_nvmem_read",["csrc/*"])
+def nvmem_read(fileid,offset,length):
+    pass
+
+@native_c("cc3000_nvmem_write",["csrc/*"])
+def nvmem_write(fileid,offset,data):
+    pass
+
+@native_c("cc3000_nvmem_create",["csrc/*"])
+def nvmem_create(fileid,length):
+    pass
+
+PATCH_VERIFY = 1
+PATCH_SKIP = 2
+PATCH_DRY_RUN = 4
+
+# fileid is one of the service pack files: 4 (driver), 5 (firmware), 10 (bootloader)
+def program_patch(fileid,data,flags=PATCH_VERIFY|PATCH_SKIP,progress=None,block=1024):
+    patch_start(fileid,len(data),flags)
+    total = len(data)
+    done = 0
+    while done<total:
+        n = total-done
+        if n>block:
+            n = block
+        patch_block(fileid,done,data[done:done+n],flags)
+        done+=n
+        if progress:
+            progress(done,total)
+    return patch_stats()
+
+@native_c("cc3000_patch_block",["csrc/*"])
+def patch_block(fileid,offset,data,flags=PATCH_VERIFY|PATCH_SKIP):
+    pass
+
+@native_c("cc3000_patch_start",["csrc/*"])
+def patch_start(fileid,length,flags=PATCH_VERIFY|PATCH_SKIP):
+    pass
+
+@native_c("cc3000_patch_reset",["csrc/*"])
+def patch_reset():
+    pass
+
+@native_c("cc3000_patch_stats",["csrc/*"])
+def patch_stats():
+    pass
+
+@native_c("cc3000_sp_version",["csrc/*"])
+def sp_version():
+    pass
+
+@native_c("cc3000_nvcache_enable",["csrc/*"])
+def nvcache_enable(fileid,size):
+    pass
+
+@native_c("cc3000_nvcache_flush",["csrc/*"])
+def nvcache_flush(fileid=-1):
+    pass
+
+@native_c("cc3000_nvcache_stats",["csrc/*"])
+def nvcache_stats(fileid):
+    pass
+
+@native_c("cc3000_config_stats",["csrc/*"])
+def config_stats():
+    pass
+
+@native_c("cc3000_link_state",["csrc/*"])
+def link_state():
+    pass
+
+@native_c("cc3000_link_wait_state",["csrc/*"])
+def link_wait(state,timeout=-1):
+    pass
+
+# IOError if the cached NVMEM writes can't be written back: the chip is then left running
+@native_c("cc3000_power_sleep",["csrc/*"])
+def power_sleep():
+    pass
+
+@native_c("cc3000_power_wake",["csrc/*"])
+def power_wake():
+    pass
+
+@native_c("cc3000_power_config",["csrc/*"])
+def power_config(reuse_lease=0,active_ua=92000,sleep_ua=5):
+    pass
+
+@native_c("cc3000_power_stats",["csrc/*"])
+def power_stats():
+    pass
+
+@native_c("cc3000_cancel",["csrc/*"])
+def cancel():
+    pass
+
+@native_c("cc3000_socket",["csrc/*"])
+def socket(family,type,proto):
+    pass
+
+@native_c("cc3000_sockopt",["csrc/*"])
+def setsockopt(sock,level,optname,value):
+    pass
+
+@native_c("cc3000_close",["csrc/*"])
+def close(sock):
+    pass
+
+@native_c("cc3000_sendto",["csrc/*"])
+def sendto(sock,buf,addr,flags=0):
+    pass
+
+@native_c("cc3000_send",["csrc/*"])
+def send(sock,buf,flags=0):
+    pass
+
+@native_c("cc3000_sendall",["csrc/*"])
+def sendall(sock,buf,flags=0):
+    pass
+
+
+@native_c("cc3000_recv_into",["csrc/*"])
+def recv_into(sock,buf,bufsize,flags=0,ofs=0):
+    pass
+
+
+@native_c("cc3000_recvfrom_into",["csrc/*"])
+def recvfrom_into(sock,buf,bufsize,flags=0):
+    pass
+
+
+@native_c("cc3000_bind",["csrc/*"])
+def bind(sock,addr):
+    pass
+
+@native_c("cc3000_listen",["csrc/*"])
+def listen(sock,maxlog=2):
+    pass
+
+@native_c("cc3000_accept",["csrc/*"])
+def accept(sock):
+    pass
+
+@native_c("cc3000_connect",["csrc/*"])
+def connect(sock,addr):
+    pass
+
+@native_c("cc3000_connect_start",["csrc/*"])
+def connect_start(sock,addr):
+    pass
+
+@native_c("cc3000_connect_poll",["csrc/*"])
+def connect_poll(sock,timeout=0):
+    pass
+
+@native_c("cc3000_select",["csrc/*"])
+def select(rlist,wlist,xlist,timeout):
+    pass
+
+@native_c("cc3000_select_into",["csrc/*"])
+def select_into(rmask,wmask,xmask,timeout,out):
+    pass
+
+@native_c("cc3000_pool_connect",["csrc/*"])
+def pool_connect(addr):
+    pass
+
+@native_c("cc3000_pool_release",["csrc/*"])
+def pool_release(sock):
+    pass
+
+@native_c("cc3000_pool_config",["csrc/*"])
+def pool_config(max_idle=30000):
+    pass
+
+@native_c("cc3000_pool_flush",["csrc/*"])
+def pool_flush():
+    pass
+
+@native_c("cc3000_socket_stats",["csrc/*"])
+def socket_stats(sock):
+    pass
+
+@native_c("cc3000_resolve",["csrc/*"])
+def gethostbyname(hostname):
+    pass
+
+@native_c("cc3000_resolve_start",["csrc/*"])
+def gethostbyname_start(hostname):
+    pass
+
+@native_c("cc3000_resolve_poll",["csrc/*"])
+def gethostbyname_poll(handle,timeout=0):
+    pass
+
+@native_c("cc3000_resolve_cancel",["csrc/*"])
+def gethostbyname_cancel(handle):
+    pass
+
+@native_c("cc3000_dns_config",["csrc/*"])
+def dns_config(ttl,negative_ttl=10000):
+    pass
+
+@native_c("cc3000_dns_flush",["csrc/*"])
+def dns_flush():
+    pass
+
+@native_c("cc3000_dns_stats",["csrc/*"])
+def dns_stats():
+    pass
+
+@native_c("cc3000_boot_timeline",["csrc/*"])
+def boot_timeline():
+    pass
+
+@native_c("cc3000_event_mask",["csrc/*"])
+def event_mask(mask):
+    pass
+
+@native_c("cc3000_event_stats",["csrc/*"])
+def event_stats():
+    pass
+
+
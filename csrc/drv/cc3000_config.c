@@ -0,0 +1,115 @@
+/** @file
+ *  @brief Shadow of the configuration the chip keeps in NVMEM.
+ *  @details netapp_dhcp(), netapp_timeout_values() and
+ *           wlan_ioctl_set_connection_policy() each rewrite the chip EEPROM.
+ *           The chip has no command to read those values back, and the
+ *           layout of NVMEM_IP_CONFIG_FILEID is firmware internal, so the
+ *           shadow holds what was last written since init and a command is
+ *           sent only when the requested values differ. The functions are
+ *           called with the global driver semaphore held. */
+
+#include "cc3000_config.h"
+#include "cc3000_api.h"
+
+static struct {
+    uint8_t valid;
+    uint32_t ip;
+    uint32_t mask;
+    uint32_t gw;
+    uint32_t dns;
+} shadow_ip;
+
+static struct {
+    uint8_t valid;
+    uint32_t dhcp;
+    uint32_t arp;
+    uint32_t keepalive;
+    uint32_t inactivity;
+} shadow_timeouts;
+
+static struct {
+    uint8_t valid;
+    uint32_t open;
+    uint32_t fast;
+    uint32_t profiles;
+} shadow_policy;
+
+cc3000ConfigStats cc3000ConfigCounters;
+
+void cc3000ConfigInit(void) {
+    cc3000ConfigForget();
+    memset(&cc3000ConfigCounters, 0, sizeof(cc3000ConfigCounters));
+}
+
+/** @brief Forgets the shadow, when the chip NVMEM may have been changed behind it. */
+void cc3000ConfigForget(void) {
+    shadow_ip.valid = 0;
+    shadow_timeouts.valid = 0;
+    shadow_policy.valid = 0;
+}
+
+/** @brief Applies a static configuration, or DHCP when @p ip is 0.
+ *  @return 0, or the error of netapp_dhcp(). */
+int cc3000ConfigIp(uint32_t ip, uint32_t mask, uint32_t gw, uint32_t dns) {
+    int32_t ret;
+
+    if (shadow_ip.valid && shadow_ip.ip == ip && shadow_ip.mask == mask &&
+            shadow_ip.gw == gw && shadow_ip.dns == dns) {
+        cc3000ConfigCounters.skipped++;
+        return 0;
+    }
+    shadow_ip.ip = ip;
+    shadow_ip.mask = mask;
+    shadow_ip.gw = gw;
+    shadow_ip.dns = dns;
+    //with ip 0 this also handles the dhcp bug: everything is reset to zero
+    ret = netapp_dhcp((UINT32 *)&ip, (UINT32 *)&mask, (UINT32 *)&gw, (UINT32 *)&dns);
+    cc3000ConfigCounters.writes++;
+    shadow_ip.valid = ret == 0;
+    return ret;
+}
+
+/** @brief Applies the DHCP, ARP, keepalive and inactivity timeouts, in seconds.
+ *  @return 0, or the error of netapp_timeout_values(). */
+int cc3000ConfigTimeouts(uint32_t dhcp, uint32_t arp, uint32_t keepalive, uint32_t inactivity) {
+    UINT32 values[4];
+    int32_t ret;
+
+    if (shadow_timeouts.valid && shadow_timeouts.dhcp == dhcp && shadow_timeouts.arp == arp &&
+            shadow_timeouts.keepalive == keepalive && shadow_timeouts.inactivity == inactivity) {
+        cc3000ConfigCounters.skipped++;
+        return 0;
+    }
+    //netapp_timeout_values() clamps its arguments in place: keep the requested ones
+    values[0] = dhcp;
+    values[1] = arp;
+    values[2] = keepalive;
+    values[3] = inactivity;
+    ret = netapp_timeout_values(&values[0], &values[1], &values[2], &values[3]);
+    cc3000ConfigCounters.writes++;
+    shadow_timeouts.valid = ret == 0;
+    shadow_timeouts.dhcp = dhcp;
+    shadow_timeouts.arp = arp;
+    shadow_timeouts.keepalive = keepalive;
+    shadow_timeouts.inactivity = inactivity;
+    return ret;
+}
+
+/** @brief Applies the connection policy.
+ *  @return 0, or the error of wlan_ioctl_set_connection_policy(). */
+int cc3000ConfigPolicy(uint32_t open, uint32_t fast, uint32_t profiles) {
+    int32_t ret;
+
+    if (shadow_policy.valid && shadow_policy.open == open && shadow_policy.fast == fast &&
+            shadow_policy.profiles == profiles) {
+        cc3000ConfigCounters.skipped++;
+        return 0;
+    }
+    ret = wlan_ioctl_set_connection_policy(open, fast, profiles);
+    cc3000ConfigCounters.writes++;
+    shadow_policy.valid = ret == 0;
+    shadow_policy.open = open;
+    shadow_policy.fast = fast;
+    shadow_policy.profiles = profiles;
+    return ret;
+}
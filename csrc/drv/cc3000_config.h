@@ -0,0 +1,23 @@
+/** @file
+ *  @brief Shadow of the configuration the chip keeps in NVMEM. */
+
+#ifndef __CC3000_CONFIG__
+#define __CC3000_CONFIG__
+
+#include "viper.h"
+
+/** @brief Counters of configuration commands, exposed to Python by config_stats(). */
+typedef struct {
+    uint32_t writes;        ///< Commands sent, each one an EEPROM write.
+    uint32_t skipped;       ///< Commands skipped, the chip already had the values.
+} cc3000ConfigStats;
+
+extern cc3000ConfigStats cc3000ConfigCounters;
+
+void cc3000ConfigInit(void);
+void cc3000ConfigForget(void);
+int cc3000ConfigIp(uint32_t ip, uint32_t mask, uint32_t gw, uint32_t dns);
+int cc3000ConfigTimeouts(uint32_t dhcp, uint32_t arp, uint32_t keepalive, uint32_t inactivity);
+int cc3000ConfigPolicy(uint32_t open, uint32_t fast, uint32_t profiles);
+
+#endif /* __CC3000_CONFIG__ */
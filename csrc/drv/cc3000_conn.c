@@ -0,0 +1,174 @@
+/** @file
+ *  @brief Tracking of TCP connects issued with connect_send().
+ *  @details A socket gets a slot when its connect is requested and keeps it
+ *           until the connect result has been consumed or the socket is
+ *           closed. HCI_EVNT_CONNECT carries no descriptor, and handshakes
+ *           to different hosts end in any order, so only one connect is in
+ *           flight on the chip: the others are queued and sent by the thread
+ *           that waits for them. Handshakes therefore still run one after
+ *           the other; what the tracker saves is the driver semaphore, which
+ *           is free for other sockets while a handshake runs. A
+ *           slot released while the chip still owes the result is kept as
+ *           abandoned until the late answer comes or the connect expires. */
+
+#include "cc3000_conn.h"
+
+static cc3000Conn conns[CC3000_CONN_SLOTS];
+static VSemaphore conn_lock = NULL;
+
+static cc3000Conn *conn_find(int32_t sd) {
+    int i;
+    for (i = 0; i < CC3000_CONN_SLOTS; i++) {
+        if (conns[i].sd == sd && conns[i].state != CC3000_CONN_ABANDONED)
+            return &conns[i];
+    }
+    return NULL;
+}
+
+static void conn_free(cc3000Conn *c) {
+    c->sd = -1;
+    c->state = CC3000_CONN_NONE;
+}
+
+/** @brief The connect the chip owes an answer for, NULL if none.
+ *  @details A connect unanswered for #CC3000_CONN_EXPIRE is given up first,
+ *           so that a lost answer does not block the queue. */
+static cc3000Conn *conn_in_flight(void) {
+    int i;
+    cc3000Conn *c;
+    for (i = 0; i < CC3000_CONN_SLOTS; i++) {
+        c = &conns[i];
+        if (c->state != CC3000_CONN_PENDING && c->state != CC3000_CONN_ABANDONED)
+            continue;
+        if ((vosMillis() - c->started) < CC3000_CONN_EXPIRE)
+            return c;
+        if (c->state == CC3000_CONN_ABANDONED) {
+            conn_free(c);
+        } else {
+            c->retval = -1;
+            c->state = CC3000_CONN_FAILED;
+        }
+    }
+    return NULL;
+}
+
+void cc3000ConnInit(void) {
+    int i;
+    if (!conn_lock)
+        conn_lock = vosSemCreate(1);
+    for (i = 0; i < CC3000_CONN_SLOTS; i++)
+        conn_free(&conns[i]);
+}
+
+/** @brief Registers a connect of @p sd to @p addr.
+ *  @details If no connect is in flight, @p send is set and the caller must
+ *           issue connect_send(), or call cc3000ConnUnsend() if that fails.
+ *           The connect is marked as sent before the command goes out, so an
+ *           early answer is not lost. Otherwise the connect is queued until
+ *           cc3000ConnClaim() lets it go.
+ *  @return 0, or -1 if @p sd already has a connect or no slot is free. */
+int cc3000ConnStart(int32_t sd, NetAddress *addr, int *send) {
+    int i, ret = -1;
+
+    *send = 0;
+    vosSemWait(conn_lock);
+    if (!conn_find(sd)) {
+        for (i = 0; i < CC3000_CONN_SLOTS; i++) {
+            if (conns[i].sd < 0) {
+                conns[i].sd = sd;
+                conns[i].retval = 0;
+                conns[i].addr = *addr;
+                if (conn_in_flight()) {
+                    conns[i].state = CC3000_CONN_QUEUED;
+                } else {
+                    conns[i].state = CC3000_CONN_PENDING;
+                    conns[i].started = vosMillis();
+                    *send = 1;
+                }
+                ret = 0;
+                break;
+            }
+        }
+    }
+    vosSemSignal(conn_lock);
+    return ret;
+}
+
+/** @brief Lets the queued connect of @p sd go to the chip once nothing is in flight.
+ *  @return 1 with @p addr filled if the caller must issue connect_send(), 0 otherwise. */
+int cc3000ConnClaim(int32_t sd, NetAddress *addr) {
+    cc3000Conn *c;
+    int ret = 0;
+
+    vosSemWait(conn_lock);
+    c = conn_find(sd);
+    if (c && c->state == CC3000_CONN_QUEUED && !conn_in_flight()) {
+        c->state = CC3000_CONN_PENDING;
+        c->started = vosMillis();
+        *addr = c->addr;
+        ret = 1;
+    }
+    vosSemSignal(conn_lock);
+    return ret;
+}
+
+/** @brief Marks the connect of @p sd as failed because it could not be sent. */
+void cc3000ConnUnsend(int32_t sd) {
+    cc3000Conn *c;
+
+    vosSemWait(conn_lock);
+    c = conn_find(sd);
+    if (c) {
+        c->retval = -1;
+        c->state = CC3000_CONN_FAILED;
+    }
+    vosSemSignal(conn_lock);
+}
+
+/** @brief Delivers an HCI_EVNT_CONNECT result to the connect in flight.
+ *  @details Called from the asynchronous callback. */
+void cc3000ConnComplete(int32_t retval) {
+    cc3000Conn *c;
+
+    vosSemWait(conn_lock);
+    c = conn_in_flight();
+    if (c) {
+        if (c->state == CC3000_CONN_ABANDONED) {
+            conn_free(c);
+        } else {
+            c->retval = retval;
+            c->state = (retval < 0) ? CC3000_CONN_FAILED : CC3000_CONN_DONE;
+        }
+    }
+    vosSemSignal(conn_lock);
+}
+
+/** @brief State of the connect issued on @p sd, #CC3000_CONN_NONE if none.
+ *         A queued connect is reported as #CC3000_CONN_PENDING. */
+int cc3000ConnState(int32_t sd) {
+    cc3000Conn *c;
+    int ret;
+
+    vosSemWait(conn_lock);
+    conn_in_flight();
+    c = conn_find(sd);
+    ret = c ? c->state : CC3000_CONN_NONE;
+    vosSemSignal(conn_lock);
+    return (ret == CC3000_CONN_QUEUED) ? CC3000_CONN_PENDING : ret;
+}
+
+/** @brief Forgets the connect on @p sd, when its result has been consumed
+ *         or the socket is closed. */
+void cc3000ConnRelease(int32_t sd) {
+    cc3000Conn *c;
+
+    vosSemWait(conn_lock);
+    c = conn_find(sd);
+    if (c) {
+        if (c->state == CC3000_CONN_PENDING)
+            c->state = CC3000_CONN_ABANDONED;
+        else
+            conn_free(c);
+    }
+    vosSemSignal(conn_lock);
+}
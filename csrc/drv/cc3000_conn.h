@@ -0,0 +1,44 @@
+/** @file
+ *  @brief Tracking of TCP connects issued with connect_send(). */
+
+#ifndef __CC3000_CONN__
+#define __CC3000_CONN__
+
+#include "viper.h"
+
+/** @brief Number of connects that can be tracked at once, one per chip socket. */
+#define CC3000_CONN_SLOTS           (8)
+
+/** @brief A connect the chip has not answered in this long is given up, in milliseconds.
+ *  @details Beyond the chip's own connect timeout, so the answer is lost. */
+#define CC3000_CONN_EXPIRE          (60000)
+
+/** @brief State of a socket connect, as returned by cc3000ConnState(). */
+#define CC3000_CONN_NONE            (0)     ///< No connect issued through the tracker.
+#define CC3000_CONN_PENDING         (1)     ///< Waiting for HCI_EVNT_CONNECT.
+#define CC3000_CONN_DONE            (2)     ///< Connected.
+#define CC3000_CONN_FAILED          (3)     ///< The chip refused or timed out the connect.
+#define CC3000_CONN_ABANDONED       (4)     ///< Socket closed, the chip still owes the result.
+#define CC3000_CONN_QUEUED          (5)     ///< Not sent yet, reported as pending.
+
+/** @brief A connect issued to the chip.
+ *  @details HCI_EVNT_CONNECT does not carry the socket descriptor, so only
+ *           one connect is sent to the chip at a time and the others wait
+ *           their turn with the address kept in @p addr. */
+typedef struct {
+    int32_t sd;                 ///< Socket descriptor, -1 when the slot is free.
+    uint8_t state;              ///< One of CC3000_CONN_*.
+    int32_t retval;             ///< Connect result once completed.
+    uint32_t started;           ///< vosMillis() when sent.
+    NetAddress addr;            ///< Peer, for a queued connect.
+} cc3000Conn;
+
+void cc3000ConnInit(void);
+int cc3000ConnStart(int32_t sd, NetAddress *addr, int *send);
+int cc3000ConnClaim(int32_t sd, NetAddress *addr);
+void cc3000ConnUnsend(int32_t sd);
+void cc3000ConnComplete(int32_t retval);
+int cc3000ConnState(int32_t sd);
+void cc3000ConnRelease(int32_t sd);
+
+#endif /* __CC3000_CONN__ */
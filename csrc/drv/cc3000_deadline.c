@@ -0,0 +1,157 @@
+/** @file
+ *  @brief Deadline and waiter service used by every blocking driver call. */
+
+#include "cc3000_deadline.h"
+
+static cc3000Waiter waiters[CC3000_MAX_WAITERS];
+
+/** @brief Creates the waiter semaphores. Must be called once before any wait. */
+void cc3000DeadlineInit(void) {
+    int i;
+    for (i = 0; i < CC3000_MAX_WAITERS; i++) {
+        if (!waiters[i].sem)
+            waiters[i].sem = vosSemCreate(0);
+        waiters[i].mask = 0;
+        waiters[i].fired = 0;
+    }
+}
+
+/** @brief Starts a deadline @p timeout milliseconds from now. */
+void cc3000DeadlineStart(cc3000Deadline *dl, uint32_t timeout) {
+    dl->start = vosMillis();
+    dl->timeout = timeout;
+}
+
+/** @brief Milliseconds left before @p dl expires, 0 if already expired.
+ *  @details Returns #CC3000_WAIT_FOREVER for deadlines without timeout. */
+uint32_t cc3000DeadlineRemaining(cc3000Deadline *dl) {
+    uint32_t elapsed;
+    if (dl->timeout == CC3000_WAIT_FOREVER)
+        return CC3000_WAIT_FOREVER;
+    elapsed = vosMillis() - dl->start;
+    if (elapsed >= dl->timeout)
+        return 0;
+    return dl->timeout - elapsed;
+}
+
+int cc3000DeadlineExpired(cc3000Deadline *dl) {
+    return cc3000DeadlineRemaining(dl) == 0;
+}
+
+/** @brief Converts the time left on @p dl to a timeval for select(). */
+void cc3000DeadlineToTimeval(cc3000Deadline *dl, struct timeval *tv) {
+    uint32_t rem = cc3000DeadlineRemaining(dl);
+    tv->tv_sec = rem / 1000;
+    tv->tv_usec = (rem % 1000) * 1000;
+}
+
+/** @brief Takes a free waiter slot interested in @p mask.
+ *  @details Take the waiter before checking the condition you wait for,
+ *           so that an event firing in between is not lost.
+ *  @return The waiter, or NULL if every slot is busy. A NULL waiter can
+ *          still be passed to cc3000WaiterWait(), which then polls. */
+cc3000Waiter *cc3000WaiterGet(uint32_t mask) {
+    return cc3000WaiterGetSocket(mask, CC3000_ANY_SOCKET);
+}
+
+/** @brief Like cc3000WaiterGet(), but per-socket events are only received
+ *         for @p sd. */
+cc3000Waiter *cc3000WaiterGetSocket(uint32_t mask, int32_t sd) {
+    int i;
+    cc3000Waiter *w = NULL;
+
+    vosSysLock();
+    for (i = 0; i < CC3000_MAX_WAITERS; i++) {
+        if (waiters[i].sem && !waiters[i].mask) {
+            w = &waiters[i];
+            w->mask = mask | CC3000_EV_CANCEL;
+            w->sd = sd;
+            w->fired = 0;
+            break;
+        }
+    }
+    vosSysUnlock();
+    return w;
+}
+
+/** @brief Sleeps until an event in the waiter mask fires or @p dl expires.
+ *  @return The events fired since the last call (cleared on return), or 0
+ *          on timeout. Callers re-check their condition after each wake. */
+uint32_t cc3000WaiterWait(cc3000Waiter *w, cc3000Deadline *dl) {
+    uint32_t rem, fired;
+
+    if (!w) {
+        rem = cc3000DeadlineRemaining(dl);
+        if (!rem)
+            return 0;
+        vosThSleep(TIME_U((rem < CC3000_WAIT_POLL_MS) ? rem : CC3000_WAIT_POLL_MS, MILLIS));
+        return CC3000_EV_POLL;
+    }
+
+    while (1) {
+        vosSysLock();
+        fired = w->fired;
+        w->fired = 0;
+        vosSysUnlock();
+        if (fired)
+            return fired;
+        rem = cc3000DeadlineRemaining(dl);
+        if (!rem)
+            return 0;
+        vosSemWaitTimeout(w->sem, (rem == CC3000_WAIT_FOREVER) ? VTIME_INFINITE : TIME_U(rem, MILLIS));
+    }
+}
+
+/** @brief Gives a waiter slot back. NULL is accepted. */
+void cc3000WaiterPut(cc3000Waiter *w) {
+    if (!w)
+        return;
+    vosSysLock();
+    w->mask = 0;
+    w->fired = 0;
+    vosSysUnlock();
+}
+
+/** @brief Fires @p events, waking every waiter interested in them. */
+void cc3000Notify(uint32_t events) {
+    int i, hit;
+    for (i = 0; i < CC3000_MAX_WAITERS; i++) {
+        vosSysLock();
+        hit = (waiters[i].mask & events) != 0;
+        if (hit)
+            waiters[i].fired |= waiters[i].mask & events;
+        vosSysUnlock();
+        if (hit)
+            vosSemSignal(waiters[i].sem);
+    }
+}
+
+/** @brief Fires per-socket @p events for @p sd, waking the waiters bound to
+ *         @p sd and those not bound to any socket. */
+void cc3000NotifySocket(uint32_t events, int32_t sd) {
+    int i, hit;
+    for (i = 0; i < CC3000_MAX_WAITERS; i++) {
+        vosSysLock();
+        hit = (waiters[i].mask & events) != 0 && (waiters[i].sd == sd || waiters[i].sd == CC3000_ANY_SOCKET);
+        if (hit)
+            waiters[i].fired |= waiters[i].mask & events;
+        vosSysUnlock();
+        if (hit)
+            vosSemSignal(waiters[i].sem);
+    }
+}
+
+/** @brief Cancels every wait interested in any event of @p mask.
+ *  @details The waiters return #CC3000_EV_CANCEL. */
+void cc3000WaitCancel(uint32_t mask) {
+    int i, hit;
+    for (i = 0; i < CC3000_MAX_WAITERS; i++) {
+        vosSysLock();
+        hit = (waiters[i].mask & mask) != 0;
+        if (hit)
+            waiters[i].fired |= CC3000_EV_CANCEL;
+        vosSysUnlock();
+        if (hit)
+            vosSemSignal(waiters[i].sem);
+    }
+}
@@ -0,0 +1,69 @@
+/** @file
+ *  @brief Deadline and waiter service used by every blocking driver call.
+ *  @details A blocking operation starts a #cc3000Deadline, grabs a
+ *           #cc3000Waiter for the events it cares about and sleeps on it.
+ *           The asynchronous callback fires events through cc3000Notify(),
+ *           so the waiting thread wakes at the first event or at the
+ *           deadline, whichever comes first. */
+
+#ifndef __CC3000_DEADLINE__
+#define __CC3000_DEADLINE__
+
+#include "viper.h"
+#include "../cc3000_common.h"
+
+/** @brief Timeout value meaning "no deadline". */
+#define CC3000_WAIT_FOREVER         (0xFFFFFFFF)
+
+/** @brief Number of threads that can wait on driver events at once. */
+#define CC3000_MAX_WAITERS          (6)
+
+/** @brief Sleep slice used when no waiter slot is free. */
+#define CC3000_WAIT_POLL_MS         (5)
+
+/** @brief Socket of a waiter that is not bound to a socket. */
+#define CC3000_ANY_SOCKET           (-1)
+
+/** @defgroup cc3000_events Driver events
+ *  @{ */
+#define CC3000_EV_CONNECT           (1 << 0)    ///< HCI_EVNT_WLAN_UNSOL_CONNECT
+#define CC3000_EV_DISCONNECT        (1 << 1)    ///< HCI_EVNT_WLAN_UNSOL_DISCONNECT
+#define CC3000_EV_DHCP              (1 << 2)    ///< HCI_EVNT_WLAN_UNSOL_DHCP
+#define CC3000_EV_RESOLVE           (1 << 3)    ///< HCI_EVNT_BSD_GETHOSTBYNAME of an async lookup
+#define CC3000_EV_SOCK_CONNECT      (1 << 4)    ///< HCI_EVNT_CONNECT of a connect_send()
+#define CC3000_EV_SOCK_CLOSE        (1 << 5)    ///< HCI_EVNT_BSD_TCP_CLOSE_WAIT, per socket
+#define CC3000_EV_POLL              (1UL << 30) ///< No slot was free, woken by the poll slice
+#define CC3000_EV_CANCEL            (1UL << 31) ///< Wait cancelled by cc3000WaitCancel()
+/** @} */
+
+/** @brief An absolute point in time, expressed as start + timeout. */
+typedef struct {
+    uint32_t start;     ///< vosMillis() when the deadline was started.
+    uint32_t timeout;   ///< Milliseconds, or #CC3000_WAIT_FOREVER.
+} cc3000Deadline;
+
+/** @brief A registered wait for a set of driver events. */
+typedef struct {
+    VSemaphore sem;             ///< Signalled when a matching event fires.
+    uint32_t mask;              ///< Events of interest, 0 when the slot is free.
+    int32_t sd;                 ///< Socket for per-socket events, or #CC3000_ANY_SOCKET.
+    volatile uint32_t fired;    ///< Events fired since the waiter was taken.
+} cc3000Waiter;
+
+void cc3000DeadlineInit(void);
+
+void cc3000DeadlineStart(cc3000Deadline *dl, uint32_t timeout);
+uint32_t cc3000DeadlineRemaining(cc3000Deadline *dl);
+int cc3000DeadlineExpired(cc3000Deadline *dl);
+void cc3000DeadlineToTimeval(cc3000Deadline *dl, struct timeval *tv);
+
+cc3000Waiter *cc3000WaiterGet(uint32_t mask);
+cc3000Waiter *cc3000WaiterGetSocket(uint32_t mask, int32_t sd);
+uint32_t cc3000WaiterWait(cc3000Waiter *w, cc3000Deadline *dl);
+void cc3000WaiterPut(cc3000Waiter *w);
+
+void cc3000Notify(uint32_t events);
+void cc3000NotifySocket(uint32_t events, int32_t sd);
+void cc3000WaitCancel(uint32_t mask);
+
+#endif /* __CC3000_DEADLINE__ */
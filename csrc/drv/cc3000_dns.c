@@ -0,0 +1,344 @@
+/** @file
+ *  @brief Host side DNS cache sitting in front of gethostbyname().
+ *  @details Entries live for a configurable TTL (the CC3000 resolver does
+ *           not report the record TTL), failed lookups are cached for a
+ *           shorter time and the least recently used entry is evicted when
+ *           the table is full. Lookups go to the chip one at a time: with a
+ *           single lookup in flight, an answer can only belong to it. */
+
+#include "cc3000_dns.h"
+
+static cc3000DnsEntry dns_cache[CC3000_DNS_CACHE_SIZE];
+static cc3000DnsQuery dns_queries[CC3000_DNS_QUERIES];
+static uint8_t dns_uncertain = 0;    //a lookup expired, its answer may still come
+static uint32_t dns_ttl = CC3000_DNS_DEFAULT_TTL;
+static uint32_t dns_neg_ttl = CC3000_DNS_DEFAULT_NEG_TTL;
+static VSemaphore dns_lock = NULL;
+
+cc3000DnsStats cc3000DnsCounters;
+
+static int dns_name_eq(cc3000DnsEntry *e, uint8_t *name, uint32_t len) {
+    uint32_t i;
+    uint8_t a, b;
+    if (e->len != len)
+        return 0;
+    for (i = 0; i < len; i++) {
+        a = e->name[i];
+        b = name[i];
+        if (a >= 'A' && a <= 'Z') a += 'a' - 'A';
+        if (b >= 'A' && b <= 'Z') b += 'a' - 'A';
+        if (a != b)
+            return 0;
+    }
+    return 1;
+}
+
+/** @brief Takes the cache lock, creating it at first use.
+ *  @details dns_flush() may be called before init(). Until then
+ *           only the Python thread, holding the GIL, gets here, so the lazy
+ *           creation does not race. */
+static void dns_wait(void) {
+    if (!dns_lock)
+        dns_lock = vosSemCreate(1);
+    vosSemWait(dns_lock);
+}
+
+/** @brief Whether the chip owes the answer of a lookup. */
+static int dns_in_flight(void) {
+    int i;
+    for (i = 0; i < CC3000_DNS_QUERIES; i++) {
+        if (dns_queries[i].state == CC3000_DNS_Q_SENT || dns_queries[i].state == CC3000_DNS_Q_ABANDONED)
+            return 1;
+    }
+    return 0;
+}
+
+/** @brief Gives up the lookup in flight once #CC3000_DNS_QUERY_EXPIRE has passed,
+ *         so that a lost answer does not block the queue. */
+static void dns_expire(uint32_t now) {
+    int i;
+    cc3000DnsQuery *dq;
+    for (i = 0; i < CC3000_DNS_QUERIES; i++) {
+        dq = &dns_queries[i];
+        if ((dq->state != CC3000_DNS_Q_SENT && dq->state != CC3000_DNS_Q_ABANDONED) ||
+                (now - dq->started) < CC3000_DNS_QUERY_EXPIRE)
+            continue;
+        dq->state = (dq->state == CC3000_DNS_Q_SENT) ? CC3000_DNS_Q_FAILED : CC3000_DNS_Q_FREE;
+        dns_uncertain = 1;
+    }
+}
+
+static int dns_is_stale(cc3000DnsEntry *e, uint32_t now) {
+    return (now - e->stored) >= (e->negative ? dns_neg_ttl : dns_ttl);
+}
+
+void cc3000DnsInit(void) {
+    cc3000DnsFlush();
+    memset(dns_queries, 0, sizeof(dns_queries));
+}
+
+/** @brief Sets the lifetime of resolved and failed lookups, in milliseconds.
+ *  @details A TTL of 0 disables caching of that kind of result. */
+void cc3000DnsConfig(uint32_t ttl, uint32_t neg_ttl) {
+    dns_ttl = ttl;
+    dns_neg_ttl = neg_ttl;
+}
+
+/** @brief Drops every cached lookup. Counters are kept. */
+void cc3000DnsFlush(void) {
+    dns_wait();
+    memset(dns_cache, 0, sizeof(dns_cache));
+    vosSemSignal(dns_lock);
+}
+
+static int dns_lookup(uint8_t *name, uint32_t len, uint32_t *ip) {
+    int i, ret = CC3000_DNS_MISS;
+    uint32_t now = vosMillis();
+
+    for (i = 0; i < CC3000_DNS_CACHE_SIZE; i++) {
+        cc3000DnsEntry *e = &dns_cache[i];
+        if (!e->used || !dns_name_eq(e, name, len))
+            continue;
+        if (dns_is_stale(e, now)) {
+            e->used = 0;
+            break;
+        }
+        e->used_at = now;
+        if (e->negative) {
+            cc3000DnsCounters.negative_hits++;
+            ret = CC3000_DNS_NEGATIVE;
+        } else {
+            *ip = e->ip;
+            cc3000DnsCounters.hits++;
+            ret = CC3000_DNS_HIT;
+        }
+        break;
+    }
+    if (ret == CC3000_DNS_MISS)
+        cc3000DnsCounters.misses++;
+    return ret;
+}
+
+static void dns_store(uint8_t *name, uint32_t len, uint32_t ip, int ok, uint32_t elapsed) {
+    int i;
+    cc3000DnsEntry *e = NULL;
+    uint32_t now = vosMillis();
+
+    cc3000DnsCounters.resolve_ms += elapsed;
+    if (len > CC3000_DNS_NAME_MAX || (ok ? dns_ttl : dns_neg_ttl) == 0)
+        return;
+    //reuse the entry for the same name, else a free or stale one, else the LRU
+    for (i = 0; i < CC3000_DNS_CACHE_SIZE; i++) {
+        if (dns_cache[i].used && dns_name_eq(&dns_cache[i], name, len)) {
+            e = &dns_cache[i];
+            break;
+        }
+    }
+    for (i = 0; !e && i < CC3000_DNS_CACHE_SIZE; i++) {
+        if (!dns_cache[i].used || dns_is_stale(&dns_cache[i], now))
+            e = &dns_cache[i];
+    }
+    if (!e) {
+        e = &dns_cache[0];
+        for (i = 1; i < CC3000_DNS_CACHE_SIZE; i++) {
+            if ((now - dns_cache[i].used_at) > (now - e->used_at))
+                e = &dns_cache[i];
+        }
+        cc3000DnsCounters.evictions++;
+    }
+    e->used = 1;
+    e->negative = !ok;
+    e->len = len;
+    memcpy(e->name, name, len);
+    e->ip = ok ? ip : 0;
+    e->stored = now;
+    e->used_at = now;
+}
+
+/** @brief Looks @p name up in the cache.
+ *  @return #CC3000_DNS_HIT with @p ip filled, #CC3000_DNS_NEGATIVE for a
+ *          cached failure or #CC3000_DNS_MISS. */
+int cc3000DnsLookup(uint8_t *name, uint32_t len, uint32_t *ip) {
+    int ret;
+    dns_wait();
+    ret = dns_lookup(name, len, ip);
+    vosSemSignal(dns_lock);
+    return ret;
+}
+
+/** @brief Stores the outcome of a chip lookup that took @p elapsed ms. */
+void cc3000DnsStore(uint8_t *name, uint32_t len, uint32_t ip, int ok, uint32_t elapsed) {
+    dns_wait();
+    dns_store(name, len, ip, ok, elapsed);
+    vosSemSignal(dns_lock);
+}
+
+/** @brief Registers an asynchronous lookup of @p name.
+ *  @details Cached results complete the query at once, unless @p flags has
+ *           #CC3000_DNS_F_NOCACHE. Otherwise, if no lookup is in flight,
+ *           @p send is set and the caller must issue gethostbyname_send(), or
+ *           call cc3000DnsQueryUnsend() if that fails; if one is, the query is
+ *           queued until cc3000DnsQueryClaim() lets it go. The query is marked
+ *           as sent before the command goes out, so an early answer is not lost.
+ *  @return The query handle, or -1 if every slot is busy. */
+int cc3000DnsQueryStart(uint8_t *name, uint32_t len, uint32_t flags, int *send) {
+    int i, q = -1;
+    cc3000DnsQuery *dq;
+
+    *send = 0;
+    dns_wait();
+    for (i = 0; i < CC3000_DNS_QUERIES; i++) {
+        if (dns_queries[i].state == CC3000_DNS_Q_FREE) {
+            q = i;
+            break;
+        }
+    }
+    if (q >= 0) {
+        dq = &dns_queries[q];
+        dq->len = len;
+        dq->flags = flags;
+        if (len <= CC3000_DNS_NAME_MAX)
+            memcpy(dq->name, name, len);
+        switch ((flags & CC3000_DNS_F_NOCACHE) ? CC3000_DNS_MISS : dns_lookup(name, len, &dq->ip)) {
+            case CC3000_DNS_HIT:
+                dq->state = CC3000_DNS_Q_DONE;
+                break;
+            case CC3000_DNS_NEGATIVE:
+                dq->state = CC3000_DNS_Q_FAILED;
+                break;
+            default:
+                dns_expire(vosMillis());
+                if (dns_in_flight()) {
+                    dq->state = CC3000_DNS_Q_QUEUED;
+                } else {
+                    dq->state = CC3000_DNS_Q_SENT;
+                    dq->started = vosMillis();
+                    *send = 1;
+                }
+        }
+    }
+    vosSemSignal(dns_lock);
+    return q;
+}
+
+/** @brief Lets queued query @p q go to the chip once nothing is in flight.
+ *  @details On success the query is marked as sent and the caller must issue
+ *           gethostbyname_send() as after cc3000DnsQueryStart(). @p name is
+ *           set to the kept host name, or to NULL if it was too long to keep.
+ *  @return 1 if the caller must send the query, 0 otherwise. */
+int cc3000DnsQueryClaim(int q, uint8_t **name, uint32_t *len) {
+    int ret = 0;
+    cc3000DnsQuery *dq;
+
+    if (q < 0 || q >= CC3000_DNS_QUERIES)
+        return 0;
+    dns_wait();
+    dns_expire(vosMillis());
+    dq = &dns_queries[q];
+    if (dq->state == CC3000_DNS_Q_QUEUED && !dns_in_flight()) {
+        dq->state = CC3000_DNS_Q_SENT;
+        dq->started = vosMillis();
+        *name = (dq->len <= CC3000_DNS_NAME_MAX) ? (uint8_t *)dq->name : NULL;
+        *len = dq->len;
+        ret = 1;
+    }
+    vosSemSignal(dns_lock);
+    return ret;
+}
+
+/** @brief Marks query @p q as failed because its command could not be sent. */
+void cc3000DnsQueryUnsend(int q) {
+    dns_wait();
+    dns_queries[q].state = CC3000_DNS_Q_FAILED;
+    vosSemSignal(dns_lock);
+}
+
+/** @brief Delivers an HCI_EVNT_BSD_GETHOSTBYNAME result to the query in flight.
+ *  @details Called from the asynchronous callback. The first answer after an
+ *           expired lookup may be the late one: it is not cached. */
+void cc3000DnsQueryComplete(int32_t retval, uint32_t addr) {
+    int i;
+    int uncertain;
+    cc3000DnsQuery *dq = NULL;
+
+    dns_wait();
+    for (i = 0; i < CC3000_DNS_QUERIES; i++) {
+        if (dns_queries[i].state == CC3000_DNS_Q_SENT || dns_queries[i].state == CC3000_DNS_Q_ABANDONED) {
+            dq = &dns_queries[i];
+            break;
+        }
+    }
+    uncertain = dns_uncertain;
+    dns_uncertain = 0;
+    if (dq) {
+        dq->ip = BLTSWAP32(addr);
+        if (!(dq->flags & CC3000_DNS_F_NOCACHE) && !uncertain)
+            dns_store((uint8_t *)dq->name, dq->len, dq->ip, retval >= 0, vosMillis() - dq->started);
+        if (dq->state == CC3000_DNS_Q_ABANDONED)
+            dq->state = CC3000_DNS_Q_FREE;
+        else
+            dq->state = (retval >= 0) ? CC3000_DNS_Q_DONE : CC3000_DNS_Q_FAILED;
+    }
+    vosSemSignal(dns_lock);
+}
+
+/** @brief Fails the queries still owed by the chip, after it has been reset.
+ *  @details Left sent, they would be matched to the answers of new queries. */
+void cc3000DnsQueryReset(void) {
+    int i;
+
+    dns_wait();
+    for (i = 0; i < CC3000_DNS_QUERIES; i++) {
+        if (dns_queries[i].state == CC3000_DNS_Q_SENT)
+            dns_queries[i].state = CC3000_DNS_Q_FAILED;
+        else if (dns_queries[i].state == CC3000_DNS_Q_ABANDONED)
+            dns_queries[i].state = CC3000_DNS_Q_FREE;
+    }
+    dns_uncertain = 0;
+    vosSemSignal(dns_lock);
+}
+
+/** @brief Collects the result of query @p q.
+ *  @return #CC3000_DNS_PENDING while the chip is resolving, otherwise
+ *          #CC3000_DNS_HIT (with @p ip filled) or #CC3000_DNS_NEGATIVE, after
+ *          which the handle is released. #CC3000_DNS_INVALID for unknown handles. */
+int cc3000DnsQueryResult(int q, uint32_t *ip) {
+    int ret;
+
+    if (q < 0 || q >= CC3000_DNS_QUERIES)
+        return CC3000_DNS_INVALID;
+    dns_wait();
+    dns_expire(vosMillis());
+    switch (dns_queries[q].state) {
+        case CC3000_DNS_Q_SENT:
+        case CC3000_DNS_Q_QUEUED:
+            ret = CC3000_DNS_PENDING;
+            break;
+        case CC3000_DNS_Q_DONE:
+            *ip = dns_queries[q].ip;
+            dns_queries[q].state = CC3000_DNS_Q_FREE;
+            ret = CC3000_DNS_HIT;
+            break;
+        case CC3000_DNS_Q_FAILED:
+            dns_queries[q].state = CC3000_DNS_Q_FREE;
+            ret = CC3000_DNS_NEGATIVE;
+            break;
+        default:
+            ret = CC3000_DNS_INVALID;
+    }
+    vosSemSignal(dns_lock);
+    return ret;
+}
+
+/** @brief Gives up on query @p q. A result still owed by the chip is
+ *         consumed (and cached) when it arrives, or expires. */
+void cc3000DnsQueryAbandon(int q) {
+    if (q < 0 || q >= CC3000_DNS_QUERIES)
+        return;
+    dns_wait();
+    if (dns_queries[q].state == CC3000_DNS_Q_SENT)
+        dns_queries[q].state = CC3000_DNS_Q_ABANDONED;
+    else
+        dns_queries[q].state = CC3000_DNS_Q_FREE;
+    vosSemSignal(dns_lock);
+}
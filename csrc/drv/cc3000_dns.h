@@ -0,0 +1,97 @@
+/** @file
+ *  @brief Host side DNS cache sitting in front of gethostbyname(). */
+
+#ifndef __CC3000_DNS__
+#define __CC3000_DNS__
+
+#include "viper.h"
+
+/** @brief Number of cached host names. */
+#define CC3000_DNS_CACHE_SIZE       (4)
+
+/** @brief Longest host name that is cached. Longer names always go to the chip. */
+#define CC3000_DNS_NAME_MAX         (48)
+
+/** @brief Default lifetime of a resolved address, in milliseconds. */
+#define CC3000_DNS_DEFAULT_TTL      (300000)
+
+/** @brief Default lifetime of a failed lookup, in milliseconds. */
+#define CC3000_DNS_DEFAULT_NEG_TTL  (10000)
+
+/** @brief Number of asynchronous lookups that can be in flight at once. */
+#define CC3000_DNS_QUERIES          (4)
+
+/** @brief How long a blocking gethostbyname() waits for the chip resolver. */
+#define CC3000_DNS_RESOLVE_TIMEOUT  (20000)
+
+/** @brief A lookup the chip has not answered in this long is given up, in milliseconds.
+ *  @details Well beyond the chip resolver timeout, so the answer is lost. */
+#define CC3000_DNS_QUERY_EXPIRE     (30000)
+
+/** @brief cc3000DnsQueryStart() flag: bypass the cache in both directions. */
+#define CC3000_DNS_F_NOCACHE        (1)
+
+/** @brief Result of cc3000DnsLookup() and cc3000DnsQueryResult(). */
+#define CC3000_DNS_MISS             (0)
+#define CC3000_DNS_HIT              (1)
+#define CC3000_DNS_NEGATIVE         (-1)
+#define CC3000_DNS_PENDING          (2)
+#define CC3000_DNS_INVALID          (-2)
+
+/** @brief State of an asynchronous lookup. */
+#define CC3000_DNS_Q_FREE           (0)
+#define CC3000_DNS_Q_SENT           (1)     ///< Waiting for HCI_EVNT_BSD_GETHOSTBYNAME.
+#define CC3000_DNS_Q_DONE           (2)     ///< Resolved, waiting to be collected.
+#define CC3000_DNS_Q_FAILED         (3)     ///< Failed, waiting to be collected.
+#define CC3000_DNS_Q_ABANDONED      (4)     ///< Given up by the host, the chip still owes the result.
+#define CC3000_DNS_Q_QUEUED         (5)     ///< Waiting for the lookup in flight to be answered.
+
+/** @brief One cached lookup. */
+typedef struct {
+    uint8_t used;                       ///< Slot holds a lookup.
+    uint8_t negative;                   ///< The chip failed to resolve the name.
+    uint8_t len;                        ///< Length of @p name.
+    char name[CC3000_DNS_NAME_MAX];     ///< Host name, not NUL terminated.
+    uint32_t ip;                        ///< Address, in NetAddress order.
+    uint32_t stored;                    ///< vosMillis() at insertion.
+    uint32_t used_at;                   ///< vosMillis() at last hit, for LRU.
+} cc3000DnsEntry;
+
+/** @brief An asynchronous lookup.
+ *  @details The answer does not carry the name, so only one lookup is sent
+ *           to the chip at a time and the others are queued. */
+typedef struct {
+    uint8_t state;                      ///< One of CC3000_DNS_Q_*.
+    uint8_t len;                        ///< Length of the host name.
+    uint8_t flags;                      ///< CC3000_DNS_F_* given at start.
+    char name[CC3000_DNS_NAME_MAX];     ///< Host name, kept only if it fits.
+    uint32_t ip;                        ///< Result, in NetAddress order.
+    uint32_t started;                   ///< vosMillis() when sent.
+} cc3000DnsQuery;
+
+/** @brief Cache counters, exposed to Python by dns_stats(). */
+typedef struct {
+    uint32_t hits;          ///< Lookups answered with an address.
+    uint32_t negative_hits; ///< Lookups answered with a cached failure.
+    uint32_t misses;        ///< Lookups that went to the chip.
+    uint32_t evictions;     ///< Live entries dropped to make room.
+    uint32_t resolve_ms;    ///< Total time spent in chip lookups.
+} cc3000DnsStats;
+
+extern cc3000DnsStats cc3000DnsCounters;
+
+void cc3000DnsInit(void);
+void cc3000DnsConfig(uint32_t ttl, uint32_t neg_ttl);
+void cc3000DnsFlush(void);
+int cc3000DnsLookup(uint8_t *name, uint32_t len, uint32_t *ip);
+void cc3000DnsStore(uint8_t *name, uint32_t len, uint32_t ip, int ok, uint32_t elapsed);
+
+int cc3000DnsQueryStart(uint8_t *name, uint32_t len, uint32_t flags, int *send);
+int cc3000DnsQueryClaim(int q, uint8_t **name, uint32_t *len);
+void cc3000DnsQueryUnsend(int q);
+void cc3000DnsQueryComplete(int32_t retval, uint32_t addr);
+int cc3000DnsQueryResult(int q, uint32_t *ip);
+void cc3000DnsQueryAbandon(int q);
+void cc3000DnsQueryReset(void);
+
+#endif /* __CC3000_DNS__ */
@@ -1,903 +1,3101 @@
-#include "cc3000_api.h"
-#include "../nvmem.h"
-#include "../socket.h"
-#include "../error_codes.h"
-#include "viper.h"
-
-//#define printf(...) vbl_printf_stdout(__VA_ARGS__)
-#define printf(...)
-
-int32_t errno;
-int32_t net_info_set = 0;
-NetAddress net_ip;
-NetAddress net_mask;
-NetAddress net_gw;
-NetAddress net_dns;
-
-static VSemaphore sem;
-
-void cc3000_prepare_addr(sockaddr *vmSocketAddr, NetAddress *addr) {
-    vmSocketAddr->sa_family = AF_INET;
-    memcpy(vmSocketAddr->sa_data, &addr->port, 2);
-    memcpy(vmSocketAddr->sa_data + 2, &addr->ip, 4);
-}
-
-
-#define MAX_SOCKETS 4
-static int32_t sockets[MAX_SOCKETS] = { -1, -1, -1, -1};
-
-const uint32_t const cc3000_wifi_sec[] = { WLAN_SEC_UNSEC, WLAN_SEC_WEP, WLAN_SEC_WPA, WLAN_SEC_WPA2};
-
-/** LOW LEVEL **/
-int cc3000_is_socket_valid(int32_t sock) {
-    int i;
-    for (i = 0; i < MAX_SOCKETS; i++) {
-        if (sockets[i] == sock)
-            return 1;
-    }
-    return 0;
-}
-
-int cc3000_handle_socket(int32_t sockvalue, int32_t replvalue) {
-    int i;
-    for (i = 0; i < MAX_SOCKETS; i++) {
-        if (sockets[i] == sockvalue) {
-            sockets[i] = replvalue;
-            return i;
-        }
-    }
-    return -1;
-}
-
-int cc3000_net_send(int32_t sock, uint8_t *buf, uint32_t len, uint32_t flags) {
-    int res = 0, tsnd, wrt = 0;
-    vosSemWait(sem);
-    printf("cc3000 sending %i bytes to %i\r\n", len, sock);
-
-    while (wrt < len) {
-        tsnd = len - wrt;
-        tsnd = tsnd < 64 ? tsnd : 64;
-        res = send(sock, buf + wrt, tsnd, flags);
-        if (res <= 0)
-            break;
-        printf("cc3000 sent %i of %i of %i/%i\n", res, tsnd, wrt, len);
-        wrt += res;
-    }
-    vosSemSignal(sem);
-    return wrt;
-}
-
-int cc3000_net_sendto(int32_t sock, uint8_t *buf, uint32_t len, uint32_t flags, NetAddress *addr) {
-    sockaddr vmSocketAddr;
-    int res;
-    printf("sending_to: %i.%i.%i.%i:%i\r\n", OAL_IP_AT(addr->ip, 0), OAL_IP_AT(addr->ip, 1), OAL_IP_AT(addr->ip, 2),
-           OAL_IP_AT(addr->ip, 3), OAL_GET_NETPORT(addr->port));
-    cc3000_prepare_addr(&vmSocketAddr, addr);
-    vosSemWait(sem);
-    res = sendto(sock, buf, len, flags, &vmSocketAddr, sizeof(sockaddr));
-    vosSemSignal(sem);
-    printf("out of sendto\n");
-    return res;
-}
-
-int cc3000_net_recv(int32_t sock, uint8_t *buf, uint32_t len, uint32_t flags) {
-    int rb = 0;
-
-    printf("recv!\n");
-    vosSemWait(sem);
-    int rrt = 0, tbr = 0;
-    while (rrt < len) {
-        tbr = ((len-rrt)>32) ? 32:(len-rrt);
-        rb = recv(sock, buf+rrt, tbr, flags);
-        if (rb < 0) {
-            if (rb != RECV_TIMED_OUT) {
-                closesocket(sock);
-                cc3000_handle_socket(sock, -1);
-            } else rrt=-rb;
-            break;
-        }
-        rrt+=rb;
-    }
-    vosSemSignal(sem);
-    printf("recv: %i read %i\r\n", rrt, buf[0]);
-    return rrt;
-}
-
-int cc3000_net_available(int32_t sock, int32_t timeout) {
-    fd_set readfd;
-    struct timeval tm;
-    FD_ZERO ( &readfd );
-    FD_SET  ( (sock), &readfd);
-
-    tm.tv_sec = 0;
-    tm.tv_usec = timeout * 1000; //TODO: add correct timeout
-
-    vosSemWait(sem);
-    int retval = select( (sock + 1), &readfd, NULL, NULL, &tm );
-    vosSemSignal(sem);
-
-    if ( (retval > 0) && (FD_ISSET((sock), &readfd)) ) {
-        return 1;
-    } else if (!cc3000_is_socket_valid(sock)) {
-        return -1;
-    } else {
-        return 0;
-    }
-}
-
-int cc3000_net_recvfrom(int32_t sock, uint8_t *buf, uint32_t len, uint32_t flags, NetAddress *addr) {
-    sockaddr vmSocketAddr;
-    socklen_t tlen;
-    int rb;
-
-    printf("recvfrom %i, %x,%i\n", sock, buf, len);
-    printf("recvfrom: %i %i %i %i %x\n", sockets[0], sockets[1], sockets[2], sockets[3], sockets);
-    while ((rb = cc3000_net_available(sock, 0)) == 0) {
-        vosThSleep(TIME_U(1, MILLIS));
-        //printf("recvfrtom: %i available %i\r\n", sock, rb);
-    }
-    vosSemWait(sem);
-    rb = recvfrom(sock, buf, len, flags, &vmSocketAddr, &tlen);
-    printf("recvfrom read %i\n", rb);
-    if (rb < 0) {
-        if (rb != RECV_TIMED_OUT) { // rb is 0 even on timeout...so...how am I supposed to differentiate the two cases? (closed socket/timeout)
-            closesocket(sock);
-            cc3000_handle_socket(sock, -1);
-            rb = 0;
-        }
-    }
-    vosSemSignal(sem);
-    printf("out of recvfrom\n");
-    memcpy(&addr->ip, vmSocketAddr.sa_data + 2, 4);
-    memcpy(&addr->port, vmSocketAddr.sa_data, 2);
-    return rb;
-}
-
-/* =============================================================================
-     CNATIVES
-   ============================================================================= */
-
-
-C_NATIVE(cc3000_init) {
-    C_NATIVE_UNWARN();
-    int32_t spi_prph;
-    int32_t nss;
-    int32_t wen;
-    int32_t irq;
-
-    printf("cc3000_init: parsing parameters\n");
-    if (parse_py_args("iiii", nargs, args, &spi_prph, &nss, &wen, &irq) != 4)
-        return ERR_TYPE_EXC;
-
-    //init vhal spi driver
-    vhalInitSPI(NULL);
-
-    printf("cc3000_init: calling init wlan\n");
-    if (cc3000WlanInit(spi_prph, nss, wen, irq) < 0)
-        return ERR_PERIPHERAL_ERROR_EXC;
-    printf("cc3000_init: creating semaphore\n");
-    sem = vosSemCreate(1);
-    RELEASE_GIL();
-
-    printf("cc3000 wlan init...\r\n");
-    vosSemWait(sem);
-    printf("cc3000 wlan init.....\r\n");
-    wlan_start(0);
-    printf("cc3000 wlan init......\r\n");
-
-    wlan_ioctl_set_connection_policy(0, 0, 0);
-
-    vosSemSignal(sem);
-
-    //wlan_disconnect();
-    printf("cc3000 wlan init.......\r\n");
-    ACQUIRE_GIL();
-    return ERR_OK;
-}
-
-const unsigned long intervalTime[16] = { 2000, 2000, 2000, 2000,  2000,
-                                         2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000
-
-                                       };
-
-_wlan_full_scan_results_args_t scan_res;
-
-
-#ifndef VIPER_CC3000_TINY_DRIVER
-C_NATIVE(cc3000_scan) {
-    C_NATIVE_UNWARN();
-    int32_t time;
-    if (parse_py_args("i", nargs, args, &time) != 1)
-        return ERR_TYPE_EXC;
-
-    printf("cc3000_scan %i\n", time);
-
-    scan_res.num_networks = 0;
-
-    RELEASE_GIL();
-    vosSemWait(sem);
-    printf("Before scan params\n");
-
-    int cr = 0;
-    wlan_ioctl_set_scan_params(time, 20, 100, 5, 0x1FFF, -120, 0, 300, (unsigned long * ) &intervalTime);
-    printf("cr %i\n", cr);
-    vosThSleep(TIME_U(time + 500, MILLIS));
-
-    cr = wlan_ioctl_get_scan_results(0, (uint8_t*)&scan_res);
-    int nn = scan_res.num_networks;
-    int i, cc = 0;
-    printf("res %i nn %i\n", cr, nn);
-
-    PList *tpl = plist_new(nn, NULL);
-    for (i = 0; i < nn; i++) {
-        printf("net %i valid %i\n", i, scan_res.scan_status);
-        if (scan_res.scan_status > 1 || !(scan_res.rssi & 1))
-            continue;
-        PTuple *itpl = ptuple_new(4, NULL);
-        PString *ssid = pstring_new(scan_res.sec_ssidlen >> 2, scan_res.ssid_name);
-        PBytes *bssid = pbytes_new(6, scan_res.bssid);
-        PTUPLE_SET_ITEM(itpl, 0, ssid);
-        PTUPLE_SET_ITEM(itpl, 1, PSMALLINT_NEW(scan_res.sec_ssidlen & 0x3));
-        PTUPLE_SET_ITEM(itpl, 2, PSMALLINT_NEW(scan_res.rssi >> 1));
-        PTUPLE_SET_ITEM(itpl, 3, bssid);
-        PLIST_SET_ITEM(tpl, cc, itpl);
-        cc++;
-        wlan_ioctl_get_scan_results(0, (uint8_t*)&scan_res);
-    }
-    PSEQUENCE_ELEMENTS(tpl) = cc;
-    *res = tpl;
-    wlan_ioctl_set_scan_params(0, 20, 100, 5, 0x1FFF, -120, 0, 300, (unsigned long * ) &intervalTime);
-
-    vosSemSignal(sem);
-    ACQUIRE_GIL();
-    //*res=MAKE_NONE();
-    return ERR_OK;
-}
-#endif
-
-C_NATIVE(cc3000_done) {
-    C_NATIVE_UNWARN();
-    RELEASE_GIL();
-    vosSemWait(sem);
-    wlan_stop();
-    vosSemSignal(sem);
-    ACQUIRE_GIL();
-    return ERR_OK;
-}
-
-
-C_NATIVE(cc3000_wifi_link) {
-    C_NATIVE_UNWARN();
-    uint8_t *ssid;
-    int sidlen;
-    int sec;
-    uint8_t *password;
-    int passlen;
-    int cloop;
-
-
-    if (parse_py_args("sis", nargs, args, &ssid, &sidlen, &sec, &password, &passlen) != 3)
-        return ERR_TYPE_EXC;
-
-    RELEASE_GIL();
-    vosSemWait(sem);
-    cloop = 0;
-
-
-    if (!net_info_set) {
-        //no static info set!
-        //handle dhcp bug: reset to zero
-        netapp_dhcp(&cloop, &cloop, &cloop, &cloop);
-        printf("dhcp on\n");
-    } else {
-        netapp_dhcp(&net_ip.ip, &net_mask.ip, &net_gw.ip, &net_dns.ip);
-        printf("dhcp off\n");
-    }
-    /*
-    wlan_stop();
-    vosThSleep(TIME_U(200,MILLIS));
-    wlan_start(0);
-    wlan_ioctl_set_connection_policy(0, 0, 0);
-    */
-
-    if (wlan_connect(cc3000_wifi_sec[sec], ssid, sidlen, NULL, password, passlen) != 0) {
-        vosSemSignal(sem);
-        ACQUIRE_GIL();
-        return ERR_IOERROR_EXC;
-    }
-    printf("cc3000 wlan link...\n");
-
-    cloop = 0;
-    while (cc3000AsyncData.connected != 1) {
-        vosThSleep(TIME_U(5, MILLIS));
-        cloop++;
-        if (cloop > 1000) {
-            vosSemSignal(sem);
-            ACQUIRE_GIL();
-            return ERR_IOERROR_EXC;
-        }
-    }
-
-    cloop = 0;
-    printf("cc3000 wlan link.....\n");
-
-    while (cc3000AsyncData.dhcp.present != 1) {
-        vosThSleep(TIME_U(5, MILLIS));
-        cloop++;
-        if (cloop > 1000) {
-            vosSemSignal(sem);
-            ACQUIRE_GIL();
-            return ERR_IOERROR_EXC;
-
-        }
-    }
-    printf("cc3000 init...ok\r\n");
-    //vosThSleep(TIME_U(100,MILLIS));
-
-    unsigned long aucDHCP       = 14400;
-    unsigned long aucARP        = 3600;
-    unsigned long aucKeepalive  = 30;
-    unsigned long aucInactivity = 0;
-    if (netapp_timeout_values(&aucDHCP, &aucARP, &aucKeepalive, &aucInactivity) != 0) {
-        printf("cc3000_init: can't set timeouts\r\n");
-        vosSemSignal(sem);
-        ACQUIRE_GIL();
-        return ERR_TYPE_EXC;
-    }
-    //stupid workaround: it seems that calling gethostbyname twice now, fixes both gethostbyname errors and udp errors...go figure -_-
-    NetAddress addr;
-    gethostbyname("localhost", 9, &addr.ip);
-    gethostbyname("localhost", 9, &addr.ip);
-
-    vosSemSignal(sem);
-    ACQUIRE_GIL();
-    //vbl_printf_stdout("wifi_link\n");
-    return ERR_OK;
-}
-
-C_NATIVE(cc3000_wifi_unlink) {
-
-    RELEASE_GIL();
-    vosSemWait(sem);
-    wlan_disconnect();
-    vosSemSignal(sem);
-    ACQUIRE_GIL();
-
-    return ERR_OK;
-}
-
-
-C_NATIVE(cc3000_sendto) {
-    C_NATIVE_UNWARN();
-    uint8_t *buf;
-    int32_t len;
-    int32_t flags;
-    int32_t sock;
-    NetAddress addr;
-    printf("In cc3000_sendto\n");
-    if (parse_py_args("isni", nargs, args,
-                      &sock,
-                      &buf, &len,
-                      &addr,
-                      &flags) != 4) return ERR_TYPE_EXC;
-
-    printf("In cc3000_sendto2\n");
-    RELEASE_GIL();
-
-    sock = cc3000_net_sendto(sock, buf, len, flags, &addr);
-
-    ACQUIRE_GIL();
-    printf("In cc3000_sendto3\n");
-
-    if (sock < 0) {
-        return ERR_IOERROR_EXC;
-    }
-    *res = PSMALLINT_NEW(sock);
-
-
-    return ERR_OK;
-}
-
-C_NATIVE(cc3000_send) {
-    C_NATIVE_UNWARN();
-    uint8_t *buf;
-    int32_t len;
-    int32_t flags;
-    int32_t sock;
-    if (parse_py_args("isi", nargs, args,
-                      &sock,
-                      &buf, &len,
-                      &flags) != 3) return ERR_TYPE_EXC;
-    RELEASE_GIL();
-    sock = cc3000_net_send(sock, buf, len, flags);
-    ACQUIRE_GIL();
-    if (sock < 0) {
-        return ERR_IOERROR_EXC;
-    }
-    *res = PSMALLINT_NEW(sock);
-    return ERR_OK;
-}
-
-
-C_NATIVE(cc3000_sendall) {
-    C_NATIVE_UNWARN();
-    uint8_t *buf;
-    int32_t len;
-    int32_t flags;
-    int32_t sock;
-    int32_t tres = 0;
-    if (parse_py_args("isi", nargs, args,
-                      &sock,
-                      &buf, &len,
-                      &flags) != 3) return ERR_TYPE_EXC;
-    RELEASE_GIL();
-    while (len > 0) {
-        printf("sendall: remaining %i at %x\n", len, buf);
-        tres = cc3000_net_send(sock, buf, len, flags);
-        printf("sendall: sent %i\n", tres);
-        if (tres < 0) {
-            break;
-        }
-        len -= tres;
-        buf += tres;
-    }
-
-    ACQUIRE_GIL();
-    if (tres < 0) {
-        return ERR_IOERROR_EXC;
-    }
-    *res = MAKE_NONE();
-    return ERR_OK;
-}
-
-C_NATIVE(cc3000_recv_into) {
-    C_NATIVE_UNWARN();
-    uint8_t *buf;
-    int32_t len;
-    int32_t sz;
-    int32_t flags;
-    int32_t ofs;
-    int32_t sock;
-    if (parse_py_args("isiiI", nargs, args,
-                      &sock,
-                      &buf, &len,
-                      &sz,
-                      &flags,
-                      0,
-                      &ofs
-                     ) != 5) return ERR_TYPE_EXC;
-    buf += ofs;
-    len -= ofs;
-    len = (sz < len) ? sz : len;
-    RELEASE_GIL();
-    sock = cc3000_net_recv(sock, buf, len, flags);
-    ACQUIRE_GIL();
-
-    if (sock < 0) {
-        if (sock == RECV_TIMED_OUT)
-            return ERR_TIMEOUT_EXC;
-        return ERR_IOERROR_EXC;
-    }
-    *res = PSMALLINT_NEW(sock);
-
-    return ERR_OK;
-}
-
-
-
-C_NATIVE(cc3000_recvfrom_into) {
-    C_NATIVE_UNWARN();
-    uint8_t *buf;
-    int32_t len;
-    int32_t sz;
-    int32_t flags;
-    int32_t ofs;
-    int32_t sock;
-    NetAddress addr;
-    if (parse_py_args("isiiI", nargs, args,
-                      &sock,
-                      &buf, &len,
-                      &sz,
-                      &flags,
-                      0,
-                      &ofs
-                     ) != 5) return ERR_TYPE_EXC;
-    buf += ofs;
-    len -= ofs;
-    len = (sz < len) ? sz : len;
-
-    RELEASE_GIL();
-    addr.ip = 0;
-    sock = cc3000_net_recvfrom(sock, buf, len, flags, &addr);
-    ACQUIRE_GIL();
-
-    if (sock < 0) {
-        if (sock == RECV_TIMED_OUT)
-            return ERR_TIMEOUT_EXC;
-        return ERR_IOERROR_EXC;
-    }
-    PTuple *tpl = (PTuple *) psequence_new(PTUPLE, 2);
-    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(sock));
-    PObject *ipo = netaddress_to_object(&addr);
-    PTUPLE_SET_ITEM(tpl, 1, ipo);
-    *res = tpl;
-
-    return ERR_OK;
-}
-
-C_NATIVE(cc3000_select) {
-    C_NATIVE_UNWARN();
-    int32_t timeout;
-    int32_t tmp, i, j, sock = -1;
-
-    if (nargs < 4)
-        return ERR_TYPE_EXC;
-
-    fd_set rfd;
-    fd_set wfd;
-    fd_set xfd;
-    struct timeval tms;
-    struct timeval *ptm;
-    PObject *rlist = args[0];
-    PObject *wlist = args[1];
-    PObject *xlist = args[2];
-    fd_set *fdsets[3] = {&rfd, &wfd, &xfd};
-    PObject *slist[3] = {rlist, wlist, xlist};
-    PObject *tm = args[3];
-
-
-    if (timeout == MAKE_NONE()) {
-        ptm = NULL;
-    } else if (IS_PSMALLINT(tm)) {
-        timeout = PSMALLINT_VALUE(tm);
-        if (timeout < 0)
-            return ERR_TYPE_EXC;
-        tms.tv_sec = timeout / 1000;
-        tms.tv_usec = (timeout % 1000) * 1000;
-        ptm = &tms;
-    } else return ERR_TYPE_EXC;
-
-    for (j = 0; j < 3; j++) {
-        tmp = PTYPE(slist[j]);
-        if (!IS_OBJ_PSEQUENCE_TYPE(tmp))
-            return ERR_TYPE_EXC;
-        FD_ZERO (fdsets[j]);
-        for (i = 0; i < PSEQUENCE_ELEMENTS(slist[j]); i++) {
-            PObject *fd = PSEQUENCE_OBJECTS(slist[j])[i];
-            if (IS_PSMALLINT(fd)) {
-                FD_SET(PSMALLINT_VALUE(fd), fdsets[j]);
-                if (PSMALLINT_VALUE(fd) > sock)
-                    sock = PSMALLINT_VALUE(fd);
-            } else return ERR_TYPE_EXC;
-        }
-    }
-
-    RELEASE_GIL();
-
-    vosSemWait(sem);
-    tmp = select( (sock + 1), fdsets[0], fdsets[1], fdsets[2], ptm );
-    vosSemSignal(sem);
-
-    if (tmp < 0) {
-        ACQUIRE_GIL();
-        return ERR_IOERROR_EXC;
-    }
-
-    PTuple *tpl = (PTuple *) psequence_new(PTUPLE, 3);
-    for (j = 0; j < 3; j++) {
-        tmp = 0;
-        for (i = 0; i < sock; i++) {
-            if (FD_ISSET(i, fdsets[j])) tmp++;
-        }
-        PTuple *rtpl = psequence_new(PTUPLE, tmp);
-        tmp = 0;
-        for (i = 0; i < sock; i++) {
-            if (FD_ISSET(i, fdsets[j])) {
-                PTUPLE_SET_ITEM(rtpl, tmp, PSMALLINT_NEW(i));
-                tmp++;
-            }
-        }
-        PTUPLE_SET_ITEM(tpl, j, rtpl);
-    }
-    *res = tpl;
-    ACQUIRE_GIL();
-    return ERR_OK;
-}
-
-
-#define DRV_SOCK_DGRAM 1
-#define DRV_SOCK_STREAM 0
-#define DRV_AF_INET 0
-
-C_NATIVE(cc3000_socket) {
-    C_NATIVE_UNWARN();
-    int32_t family;
-    int32_t type;
-    int32_t proto;
-    if (parse_py_args("III", nargs, args, DRV_AF_INET, &family, DRV_SOCK_STREAM, &type, IPPROTO_TCP, &proto) != 3)
-        return ERR_TYPE_EXC;
-    if (type != DRV_SOCK_DGRAM && type != DRV_SOCK_STREAM)
-        return ERR_TYPE_EXC;
-    if (family != DRV_AF_INET)
-        return ERR_UNSUPPORTED_EXC;
-    printf("cc3000_socket %i %i %i %i %i %i\n", family, type, proto, args[0], args[1], args[2]);
-    RELEASE_GIL();
-    vosSemWait(sem);
-    int32_t sock = socket(AF_INET, (type == DRV_SOCK_DGRAM) ? SOCK_DGRAM : SOCK_STREAM,
-                          (type == DRV_SOCK_DGRAM) ? IPPROTO_UDP : IPPROTO_TCP);
-    vosSemSignal(sem);
-    ACQUIRE_GIL();
-    printf("CMD_SOCKET: %i\r\n", sock);
-    if (sock < 0)
-        return ERR_IOERROR_EXC;
-    cc3000_handle_socket(-1, sock);
-    printf("CMD_SOCKET: %i %i %i %i\n", sockets[0], sockets[1], sockets[2], sockets[3]);
-    *res = PSMALLINT_NEW(sock);
-    return ERR_OK;
-}
-
-
-C_NATIVE(cc3000_bind) {
-    C_NATIVE_UNWARN();
-    int32_t sock;
-    NetAddress addr;
-    if (parse_py_args("in", nargs, args, &sock, &addr) != 2)
-        return ERR_TYPE_EXC;
-    sockaddr serverSocketAddr;
-    printf("binding_to: %i.%i.%i.%i:%i\r\n", OAL_IP_AT(addr.ip, 0), OAL_IP_AT(addr.ip, 1), OAL_IP_AT(addr.ip, 2),
-           OAL_IP_AT(addr.ip, 3), OAL_GET_NETPORT(addr.port));
-    addr.ip = 0;
-    cc3000_prepare_addr(&serverSocketAddr, &addr);
-    printf("binding to: %i.%i.%i.%i: %i-%i\r\n", serverSocketAddr.sa_data[2], serverSocketAddr.sa_data[3],
-           serverSocketAddr.sa_data[4], serverSocketAddr.sa_data[5], serverSocketAddr.sa_data[0], serverSocketAddr.sa_data[1]);
-    RELEASE_GIL();
-    vosSemWait(sem);
-    sock = bind(sock, &serverSocketAddr, sizeof(sockaddr));
-    vosSemSignal(sem);
-    ACQUIRE_GIL();
-    printf("binding: %i\r\n", sock);
-    if (sock < 0)
-        return ERR_IOERROR_EXC;
-    *res = MAKE_NONE();
-    return ERR_OK;
-}
-
-
-C_NATIVE(cc3000_sockopt) {
-    C_NATIVE_UNWARN();
-    int32_t sock;
-    int32_t level;
-    int32_t optname;
-    int32_t optvalue;
-
-    if (parse_py_args("iiii", nargs, args, &sock, &level, &optname, &optvalue) != 4)
-        return ERR_TYPE_EXC;
-
-    vosSemWait(sem);
-    sock = setsockopt(sock, level, optname, &optvalue, sizeof(optvalue));
-    vosSemSignal(sem);
-    if (sock < 0)
-        return ERR_IOERROR_EXC;
-
-    *res = MAKE_NONE();
-    return ERR_OK;
-}
-
-C_NATIVE(cc3000_listen) {
-    C_NATIVE_UNWARN();
-    int32_t maxlog;
-    int32_t sock;
-    if (parse_py_args("ii", nargs, args, &sock, &maxlog) != 2)
-        return ERR_TYPE_EXC;
-    RELEASE_GIL();
-    vosSemWait(sem);
-    maxlog = listen(sock, maxlog);
-    vosSemSignal(sem);
-    ACQUIRE_GIL();
-    if (maxlog)
-        return ERR_IOERROR_EXC;
-    *res = MAKE_NONE();
-    return ERR_OK;
-}
-
-
-C_NATIVE(cc3000_accept) {
-    C_NATIVE_UNWARN();
-    int32_t sock;
-    NetAddress addr;
-    if (parse_py_args("i", nargs, args, &sock) != 1)
-        return ERR_TYPE_EXC;
-    sockaddr clientaddr;
-    socklen_t addrlen;
-    memset(&clientaddr, 0, sizeof(sockaddr));
-    addrlen = sizeof(sockaddr);
-    RELEASE_GIL();
-    vosSemWait(sem);
-    char arg = SOCK_ON;
-    if (setsockopt(sock, SOL_SOCKET, SOCKOPT_ACCEPT_NONBLOCK, &arg, sizeof(arg)) < 0) {
-        printf("CMD_ACCEPT: no sockopt");
-        sock = -1;
-    }
-    vosSemSignal(sem);
-    if (sock >= 0) {
-        int32_t ecd = SOC_IN_PROGRESS;
-        while (ecd <= -1) {
-            vosSemWait(sem);
-            ecd = accept(sock, &clientaddr, &addrlen);
-            vosSemSignal(sem);
-            if (ecd <= -1) vosThSleep(TIME_U(200, MILLIS));
-            printf("CMD_ACCEPT: accept state %i\r\n", ecd);
-        }
-        sock = ecd;
-    }
-    ACQUIRE_GIL();
-    if (sock < 0)
-        return ERR_IOERROR_EXC;
-
-    memcpy(&addr.ip, clientaddr.sa_data + 2, 4);
-    memcpy(&addr.port, clientaddr.sa_data, 2);
-    addr.ip = BLTSWAP32(addr.ip);
-    printf("CMD_ACCEPT: %i\r\n", sock);
-    PTuple *tpl = (PTuple *) psequence_new(PTUPLE, 2);
-    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(sock));
-    PObject *ipo = netaddress_to_object(&addr);
-    PTUPLE_SET_ITEM(tpl, 1, ipo);
-    *res = tpl;
-    return ERR_OK;
-}
-
-C_NATIVE(cc3000_connect) {
-    C_NATIVE_UNWARN();
-    int32_t sock;
-    NetAddress addr;
-
-    if (parse_py_args("in", nargs, args, &sock, &addr) != 2)
-        return ERR_TYPE_EXC;
-    sockaddr vmSocketAddr;
-    printf("connecting_to: %i.%i.%i.%i:%i\r\n", OAL_IP_AT(addr.ip, 0), OAL_IP_AT(addr.ip, 1), OAL_IP_AT(addr.ip, 2),
-           OAL_IP_AT(addr.ip, 3), OAL_GET_NETPORT(addr.port));
-    cc3000_prepare_addr(&vmSocketAddr, &addr);
-    RELEASE_GIL();
-    vosSemWait(sem);
-    sock = connect(sock, &vmSocketAddr, sizeof(vmSocketAddr));
-    vosSemSignal(sem);
-    ACQUIRE_GIL();
-    printf("CMD_OPEN: %i\r\n", sock);
-    if (sock < 0) {
-        return ERR_IOERROR_EXC;
-    }
-    *res = PSMALLINT_NEW(sock);
-    return ERR_OK;
-}
-
-C_NATIVE(cc3000_close) {
-    C_NATIVE_UNWARN();
-    int32_t sock;
-    if (parse_py_args("i", nargs, args, &sock) != 1)
-        return ERR_TYPE_EXC;
-    RELEASE_GIL();
-    vosSemWait(sem);
-    closesocket(sock);
-    vosSemSignal(sem);
-    ACQUIRE_GIL();
-    cc3000_handle_socket(sock, -1);
-    *res = PSMALLINT_NEW(sock);
-    return ERR_OK;
-}
-
-C_NATIVE(cc3000_resolve) {
-    C_NATIVE_UNWARN();
-    uint8_t *url;
-    uint32_t len;
-    NetAddress addr;
-    int32_t sock;
-    if (parse_py_args("s", nargs, args, &url, &len) != 1)
-        return ERR_TYPE_EXC;
-    addr.ip = 0;
-    RELEASE_GIL();
-    vosSemWait(sem);
-    sock = gethostbyname(url, len, &addr.ip);
-    vosSemSignal(sem);
-    ACQUIRE_GIL();
-    printf("resolve %i %s\n", sock, url);
-    if (sock < 0)
-        return ERR_IOERROR_EXC;
-    addr.port = 0;
-    addr.ip = BLTSWAP32(addr.ip);
-    *res = netaddress_to_object(&addr);
-    return ERR_OK;
-
-}
-
-C_NATIVE(cc3000_set_info) {
-    C_NATIVE_UNWARN();
-
-    NetAddress ip;
-    NetAddress mask;
-    NetAddress gw;
-    NetAddress dns;
-
-    if (parse_py_args("nnnn", nargs, args,
-                      &ip,
-                      &mask,
-                      &gw,
-                      &dns) != 4) return ERR_TYPE_EXC;
-
-    if (dns.ip == 0) {
-        OAL_MAKE_IP(dns.ip, 8, 8, 8, 8);
-    }
-    if (mask.ip == 0) {
-        OAL_MAKE_IP(mask.ip, 255, 255, 255, 255);
-    }
-    if (gw.ip == 0) {
-        OAL_MAKE_IP(gw.ip, OAL_IP_AT(ip.ip, 0), OAL_IP_AT(ip.ip, 1), OAL_IP_AT(ip.ip, 2), 1);
-    }
-
-    net_ip.ip = ip.ip;
-    net_gw.ip = gw.ip;
-    net_dns.ip = dns.ip;
-    net_mask.ip = mask.ip;
-    if (ip.ip != 0)
-        net_info_set = 1;
-    else
-        net_info_set = 0;
-
-    *res = MAKE_NONE();
-    return ERR_OK;
-
-}
-
-C_NATIVE(cc3000_info) {
-    C_NATIVE_UNWARN();
-    tNetappIpconfigRetArgs ipConfig;
-    NetAddress addr;
-
-    printf("before ipconfig\n");
-    RELEASE_GIL();
-    vosSemWait(sem);
-    netapp_ipconfig(&ipConfig);
-    vosSemSignal(sem);
-    ACQUIRE_GIL();
-
-    PTuple *tpl = psequence_new(PTUPLE, 5);
-
-    addr.port = 0;
-    uint8_t *tb = ipConfig.aucIP;
-    printf("   >ip: %i.%i.%i.%i\r\n", tb[0], tb[1], tb[2], tb[3]);
-    memcpy(&addr.ip, ipConfig.aucIP, 4);
-    addr.ip = BLTSWAP32(addr.ip);
-    printf("   >ip: %i.%i.%i.%i\r\n", OAL_IP_AT(addr.ip, 0), OAL_IP_AT(addr.ip, 1), OAL_IP_AT(addr.ip, 2), OAL_IP_AT(addr.ip,
-            3));
-
-    PTUPLE_SET_ITEM(tpl, 0, netaddress_to_object(&addr));
-
-    tb = ipConfig.aucSubnetMask;
-    printf(" >mask: %i.%i.%i.%i\r\n", tb[0], tb[1], tb[2], tb[3]);
-    memcpy(&addr.ip, ipConfig.aucSubnetMask, 4);
-    addr.ip = BLTSWAP32(addr.ip);
-    printf(" >mask: %i.%i.%i.%i\r\n", OAL_IP_AT(addr.ip, 0), OAL_IP_AT(addr.ip, 1), OAL_IP_AT(addr.ip, 2), OAL_IP_AT(addr.ip,
-            3));
-    PTUPLE_SET_ITEM(tpl, 1, netaddress_to_object(&addr));
-
-    tb = ipConfig.aucDefaultGateway;
-    printf("   >gw: %i.%i.%i.%i\r\n", tb[0], tb[1], tb[2], tb[3]);
-    memcpy(&addr.ip, ipConfig.aucDefaultGateway, 4);
-    addr.ip = BLTSWAP32(addr.ip);
-    printf("   >gw: %i.%i.%i.%i\r\n", OAL_IP_AT(addr.ip, 0), OAL_IP_AT(addr.ip, 1), OAL_IP_AT(addr.ip, 2), OAL_IP_AT(addr.ip,
-            3));
-    PTUPLE_SET_ITEM(tpl, 2, netaddress_to_object(&addr));
-
-    tb = ipConfig.aucDNSServer;
-    printf("  >dns: %i.%i.%i.%i\r\n", tb[0], tb[1], tb[2], tb[3]);
-    memcpy(&addr.ip, ipConfig.aucDNSServer, 4);
-    addr.ip = BLTSWAP32(addr.ip);
-    printf("  >dns: %i.%i.%i.%i\r\n", OAL_IP_AT(addr.ip, 0), OAL_IP_AT(addr.ip, 1), OAL_IP_AT(addr.ip, 2), OAL_IP_AT(addr.ip,
-            3));
-    PTUPLE_SET_ITEM(tpl, 3, netaddress_to_object(&addr));
-
-    PObject *mac = psequence_new(PBYTES, 6);
-    memcpy(PSEQUENCE_BYTES(mac), ipConfig.uaMacAddr, 6);
-    PTUPLE_SET_ITEM(tpl, 4, mac);
-    *res = tpl;
-    return ERR_OK;
+#include "cc3000_api.h"
+#include "cc3000_deadline.h"
+#include "cc3000_dns.h"
+#include "cc3000_conn.h"
+#include "cc3000_link.h"
+#include "cc3000_scan.h"
+#include "cc3000_config.h"
+#include "cc3000_nvcache.h"
+#include "cc3000_patch.h"
+#include "cc3000_spi.h"
+#include "../hci.h"
+#include "../nvmem.h"
+#include "../socket.h"
+#include "../evnt_handler.h"
+#include "../error_codes.h"
+#include "viper.h"
+
+//#define printf(...) vbl_printf_stdout(__VA_ARGS__)
+#define printf(...)
+
+int32_t errno;
+int32_t net_info_set = 0;
+NetAddress net_ip;
+NetAddress net_mask;
+NetAddress net_gw;
+NetAddress net_dns;
+
+static VSemaphore sem;
+static VSemaphore link_sem;
+static volatile uint8_t resolver_cold = 0;
+
+/** @brief Duration of the phases of the last wifi_link(), in milliseconds. */
+static struct {
+    uint32_t connect_ms;
+    uint32_t dhcp_ms;
+    uint32_t total_ms;
+    uint32_t warmup_ms;     //resolver priming, paid by the first lookup or sendto()
+} link_timing;
+
+/** @brief Network of the last wifi_link(), joined again by power_wake(). */
+static struct {
+    uint8_t valid;
+    uint8_t sec;
+    uint8_t sidlen;
+    uint8_t passlen;
+    uint8_t ssid[32];
+    uint8_t password[64];
+    uint8_t bssid_src;      //LINK_BSSID_*
+    uint8_t bssid[6];       //access point to try first
+} link_params;
+
+#define LINK_BSSID_NONE     0
+#define LINK_BSSID_SCAN     1   //best rssi of the last scan
+#define LINK_BSSID_USER     2   //given to link()
+
+/** @brief Last link_info(), in chip byte order. */
+typedef struct {
+    uint8_t valid;
+    uint8_t mac_valid;
+    uint32_t epoch;         //link epoch it was built at
+    uint32_t stored;        //vosMillis() when built
+    uint8_t ip[4];
+    uint8_t mask[4];
+    uint8_t gw[4];
+    uint8_t dns[4];
+    uint8_t mac[6];
+    uint32_t hits;          //calls served without rebuilding
+    uint32_t refreshes;     //calls that asked the chip
+} cc3000Info;
+
+/** @brief Read and replaced whole with the global semaphore held. */
+static cc3000Info info_cache;
+
+/** @brief Fast rejoin through the chip connection policy, see init(rejoin=True). */
+static struct {
+    uint8_t enabled;        //fast connect and profiles turned on at init
+    uint8_t stored;         //profile of link_params stored since boot
+    uint8_t warm;           //last link completed by a join the chip started itself
+    uint32_t started;       //vosMillis() at the last wlan_start()
+    uint32_t cold_ms;       //last link joined by wlan_connect(), from link()
+    uint32_t warm_ms;       //last link joined by the chip, from wlan_start()
+} rejoin;
+
+#define CC3000_LINK_CONNECT_TIMEOUT     5000
+#define CC3000_LINK_DHCP_TIMEOUT        5000
+#define CC3000_SCAN_SETTLE_TIME         500
+#define CC3000_SCAN_POLL_TIME           100
+#define CC3000_SCAN_CHANNELS_ALL        0x1FFF
+#define CC3000_SCAN_MAX_PROBES          10
+#define CC3000_SCAN_BG_DURATION         1000
+#define CC3000_SCAN_BG_STACK            1536
+#define CC3000_ACCEPT_POLL_TIME         200
+#define CC3000_CONNECT_TIMEOUT          30000
+#define CC3000_RESOLVER_WARMUP_TIMEOUT  2000
+#define CC3000_RESOLVER_WARMUP_LOOKUPS  2
+#define CC3000_SELECT_POLL_TIME         50
+#define CC3000_RECV_POLL_TIME           10
+#define CC3000_RECV_POLL_MAX            80
+#define CC3000_POOL_IDLE_TIMEOUT        30000
+#define CC3000_POWER_ACTIVE_UA          92000
+#define CC3000_POWER_SLEEP_UA           5
+#define CC3000_DHCP_LEASE_TIME          14400
+#define CC3000_ROAM_HYSTERESIS          10
+#define CC3000_INFO_MAX_AGE             60000
+#define CC3000_NVMEM_USER_FIRST         NVMEM_AES128_KEY_FILEID
+#define CC3000_NVMEM_USER_LAST          15
+#define CC3000_NVMEM_MAX_LEN            4096
+
+/** @brief Values returned by wlan_ioctl_statusget(). */
+#define CC3000_WLAN_STATUS_DISCONNECTED 0
+#define CC3000_WLAN_STATUS_SCANNING     1
+#define CC3000_WLAN_STATUS_CONNECTING   2
+#define CC3000_WLAN_STATUS_CONNECTED    3
+
+/* nvmem_read() reads here with the GIL released, where a new bytes object
+   would be unreachable to the collector: it is built once the GIL is back. */
+static uint8_t nvmem_buf[CC3000_NVMEM_MAX_LEN];
+static VSemaphore nvmem_buf_lock;
+
+/** @brief Roaming between access points of the linked network, see roam_config(). */
+static struct {
+    uint8_t enabled;
+    uint8_t known;          //bssid is the access point in use
+    uint8_t bssid[6];
+    int32_t hysteresis;     //rssi gain needed to move
+    int32_t rssi;           //of the access point in use, at the last check
+    uint32_t checks;
+    uint32_t roams;
+    uint32_t failures;      //roams that lost the link
+    uint32_t last_outage_ms;
+    uint32_t total_outage_ms;
+    uint8_t opened;         //pooled connections opened again, bit n for sd n
+    uint32_t opened_at;
+} roam = {0, 0, {0}, CC3000_ROAM_HYSTERESIS};
+
+/** @brief Unsolicited events the driver can live without. Connect, disconnect,
+ *         DHCP and close-wait events are always needed. */
+#define CC3000_EVENT_MASK_OPTIONAL  (HCI_EVNT_WLAN_UNSOL_INIT | HCI_EVNT_WLAN_TX_COMPLETE | \
+                                     HCI_EVNT_WLAN_ASYNC_PING_REPORT | \
+                                     HCI_EVNT_WLAN_ASYNC_SIMPLE_CONFIG_DONE | \
+                                     HCI_EVNT_WLAN_KEEPALIVE)
+
+/** @brief Events masked at init: each keepalive costs an irq and a full SPI
+ *         read, each tx completion a trip through the callback. */
+#define CC3000_EVENT_MASK_DEFAULT   (HCI_EVNT_WLAN_TX_COMPLETE | HCI_EVNT_WLAN_KEEPALIVE)
+
+/** @brief Mask applied at every wlan_start(), see event_mask(). */
+static uint32_t event_mask = CC3000_EVENT_MASK_DEFAULT;
+
+/** @brief Background refresh of the scan cache, set by scan_cache_config(). */
+static struct {
+    VThread *thread;
+    VSemaphore wake;        ///< Signalled when the configuration changes.
+    VSemaphore lock;        ///< Serializes background scans and scan_start().
+    uint32_t interval;      ///< Milliseconds between scans, 0 when off.
+    uint32_t duration;      ///< Of each background scan.
+    uint32_t runs;          ///< Background scans done.
+} scan_bg = {NULL, NULL, NULL, 0, CC3000_SCAN_BG_DURATION, 0};
+
+void cc3000_prepare_addr(sockaddr *vmSocketAddr, NetAddress *addr) {
+    vmSocketAddr->sa_family = AF_INET;
+    memcpy(vmSocketAddr->sa_data, &addr->port, 2);
+    memcpy(vmSocketAddr->sa_data + 2, &addr->ip, 4);
+}
+
+
+const uint32_t const cc3000_wifi_sec[] = { WLAN_SEC_UNSEC, WLAN_SEC_WEP, WLAN_SEC_WPA, WLAN_SEC_WPA2};
+
+/** LOW LEVEL **/
+
+/** SOCKET REGISTRY **/
+/* One entry per chip descriptor, indexed by sd: the firmware hands out the
+   descriptors accepted by M_IS_VALID_SD(). Pool fields are only touched with
+   the GIL held; sockets are closed with the GIL released. */
+
+#define CC3000_MAX_SD   8
+//the host driver's own bound on descriptors: sd masks are uint8_t, so at most 8
+#if !M_IS_VALID_SD(CC3000_MAX_SD - 1) || M_IS_VALID_SD(CC3000_MAX_SD)
+#error "CC3000_MAX_SD does not match M_IS_VALID_SD() in evnt_handler.h"
+#endif
+
+#define DRV_SOCK_DGRAM 1
+#define DRV_SOCK_STREAM 0
+#define DRV_AF_INET 0
+
+#define POOL_FREE   0
+#define POOL_LEASED 1
+#define POOL_PARKED 2
+
+typedef struct {
+    uint8_t valid;          //opened by this driver and not closed yet
+    uint8_t type;           //DRV_SOCK_STREAM or DRV_SOCK_DGRAM
+    volatile uint8_t eof;   //the peer sent FIN (HCI_EVNT_BSD_TCP_CLOSE_WAIT)
+    uint8_t pool;           //POOL_* state
+    NetAddress peer;        //connect address, key of the pool
+    uint32_t idle_since;    //vosMillis() when parked
+    uint32_t rcvtimeo;      //last SOCKOPT_RECV_TIMEOUT, 0 if never set
+    uint32_t rx_bytes;
+    uint32_t tx_bytes;
+} cc3000Socket;
+
+static cc3000Socket socks[CC3000_MAX_SD];
+static uint32_t pool_max_idle = CC3000_POOL_IDLE_TIMEOUT;
+
+/* Sockets lost by power_sleep() while Python objects still hold them: bit n
+   stands for descriptor n. Calls on them raise until they are closed, and
+   while they are not, a new socket that the chip gives the same number is
+   kept open and not handed out, so the old objects cannot reach it. Both
+   masks are changed with the driver semaphore held. */
+static uint8_t stale_sds;
+static uint8_t reserved_sds;
+
+/** @brief State of the duty-cycled power mode, see power_sleep(). */
+static struct {
+    uint8_t asleep;
+    uint8_t reuse_lease;        //join again with the last DHCP lease as static config
+    uint8_t lease_valid;
+    uint8_t lease_applied;      //the link runs on the reused lease, not on a fresh one
+    uint32_t lease_at;          //vosMillis() when the lease was obtained
+    uint8_t await_tx;           //waiting for the first send after a wake
+    struct {
+        uint32_t ip;
+        uint32_t mask;
+        uint32_t gw;
+        uint32_t dns;
+    } lease;
+    uint8_t npeers;
+    NetAddress peers[CC3000_MAX_SD];    //pooled connections, opened again at wake
+    uint32_t since;             //vosMillis() of the last sleep or wake
+    uint32_t cycles;
+    uint32_t resume_ms;         //wake to link up
+    uint32_t first_tx_ms;       //wake to first packet sent
+    uint32_t awake_ms;          //last period awake
+    uint32_t sleep_ms;          //last period asleep
+    uint32_t active_ua;         //current drawn awake, for the charge estimate
+    uint32_t sleep_ua;          //current drawn with WLAN_EN low
+} power = { .active_ua = CC3000_POWER_ACTIVE_UA, .sleep_ua = CC3000_POWER_SLEEP_UA };
+
+static cc3000Socket *cc3000_socket_get(int32_t sd) {
+    return M_IS_VALID_SD(sd) ? &socks[sd] : NULL;
+}
+
+int cc3000_is_socket_valid(int32_t sock) {
+    cc3000Socket *s = cc3000_socket_get(sock);
+    return s && s->valid;
+}
+
+static void cc3000_socket_open(int32_t sd, uint8_t type) {
+    cc3000Socket *s = cc3000_socket_get(sd);
+    if (!s)
+        return;
+    memset(s, 0, sizeof(cc3000Socket));
+    s->type = type;
+    s->valid = 1;
+}
+
+/** @brief Marks @p sd as closed on the chip. */
+static void cc3000_socket_drop(int32_t sd) {
+    cc3000Socket *s = cc3000_socket_get(sd);
+    if (!s)
+        return;
+    s->valid = 0;
+    s->pool = POOL_FREE;
+}
+
+/** @brief Whether @p sd was lost by power_sleep() and not closed since. */
+static int cc3000_socket_stale(int32_t sd) {
+    return M_IS_VALID_SD(sd) && (stale_sds & (1 << sd));
+}
+
+/** @brief Opens a chip socket whose number is not held by a stale object. */
+static int32_t cc3000_net_socket(long type, long proto) {
+    int32_t sock;
+
+    vosSemWait(sem);
+    while ((sock = socket(AF_INET, type, proto)) >= 0 && cc3000_socket_stale(sock))
+        reserved_sds |= 1 << sock;
+    vosSemSignal(sem);
+    return sock;
+}
+
+/** @brief Closes a stale descriptor: frees its number and the chip socket holding it. */
+static void cc3000_socket_forget(int32_t sd) {
+    vosSemWait(sem);
+    stale_sds &= ~(1 << sd);
+    if (reserved_sds & (1 << sd)) {
+        reserved_sds &= ~(1 << sd);
+        closesocket(sd);
+    }
+    vosSemSignal(sem);
+}
+
+/** @brief Called by the asynchronous callback on HCI_EVNT_BSD_TCP_CLOSE_WAIT. */
+void cc3000_handle_close_wait(int32_t sd) {
+    cc3000Socket *s = cc3000_socket_get(sd);
+    if (s)
+        s->eof = 1;
+}
+
+static int cc3000_socket_eof(int32_t sd) {
+    cc3000Socket *s = cc3000_socket_get(sd);
+    return s && s->eof;
+}
+
+static void cc3000_socket_count(int32_t sd, int32_t rx, int32_t tx) {
+    cc3000Socket *s = cc3000_socket_get(sd);
+    if (!s)
+        return;
+    if (rx > 0)
+        s->rx_bytes += rx;
+    if (tx > 0) {
+        s->tx_bytes += tx;
+        if (power.await_tx) {
+            power.first_tx_ms = vosMillis() - power.since;
+            power.await_tx = 0;
+        }
+    }
+}
+
+static int cc3000_pool_alive(int32_t sock) {
+    //a FIN marks the socket eof, a read of 0 bytes marks it inactive on the chip
+    return cc3000_is_socket_valid(sock) && !cc3000_socket_eof(sock) &&
+           get_socket_active_status(sock) == SOCKET_STATUS_ACTIVE;
+}
+
+/** @brief Parks the sockets connected again by the roaming check.
+ *  @details The scan thread runs without the GIL, so it only lists them. */
+static void cc3000_pool_adopt(void) {
+    int32_t sd;
+
+    vosSemWait(sem);
+    for (sd = 0; sd < CC3000_MAX_SD; sd++) {
+        if (!(roam.opened & (1 << sd)))
+            continue;
+        socks[sd].pool = POOL_PARKED;
+        socks[sd].idle_since = roam.opened_at;
+    }
+    roam.opened = 0;
+    vosSemSignal(sem);
+}
+
+/** @brief Frees parked sockets that are dead or idle for too long.
+ *  @return The number of sockets stored in @p dead, to be closed by the caller. */
+static int cc3000_pool_expire(int32_t *dead) {
+    int32_t sd;
+    int ndead = 0;
+    uint32_t now = vosMillis();
+
+    cc3000_pool_adopt();
+    for (sd = 0; sd < CC3000_MAX_SD; sd++) {
+        if (socks[sd].pool != POOL_PARKED)
+            continue;
+        if (!cc3000_pool_alive(sd) || (now - socks[sd].idle_since) >= pool_max_idle) {
+            dead[ndead++] = sd;
+            socks[sd].pool = POOL_FREE;
+        }
+    }
+    return ndead;
+}
+
+static void cc3000_resolve_send(int q, uint8_t *url, uint32_t len) {
+    vosSemWait(sem);
+    if (!url || gethostbyname_send((CHAR *)url, len) != 0)
+        cc3000DnsQueryUnsend(q);
+    vosSemSignal(sem);
+}
+
+/** @brief Starts an asynchronous lookup of @p url.
+ *  @details The global semaphore is held only while the command is sent:
+ *           the answer is delivered by CC3000AsyncCb() through
+ *           cc3000DnsQueryComplete(). A lookup queued behind the one in
+ *           flight is sent by cc3000_resolve_wait().
+ *  @return The query handle, or -1 if no query slot is free. */
+static int cc3000_resolve_submit(uint8_t *url, uint32_t len, uint32_t flags) {
+    int q, send;
+
+    q = cc3000DnsQueryStart(url, len, flags, &send);
+    if (q >= 0 && send)
+        cc3000_resolve_send(q, url, len);
+    return q;
+}
+
+/** @brief Waits up to @p timeout ms for query @p q to complete, sending it
+ *         when its turn comes.
+ *  @details @p url is used when the host name was too long to be kept with
+ *           the query: without it such a query fails.
+ *  @return The cc3000DnsQueryResult() of @p q. */
+static int cc3000_resolve_wait(int q, uint8_t *url, uint32_t len, uint32_t timeout, uint32_t *ip) {
+    cc3000Deadline dl;
+    cc3000Waiter *w;
+    uint8_t *name;
+    uint32_t namelen;
+    uint32_t fired;
+    int ret;
+
+    cc3000DeadlineStart(&dl, timeout);
+    w = cc3000WaiterGet(CC3000_EV_RESOLVE);
+    while (1) {
+        if (cc3000DnsQueryClaim(q, &name, &namelen))
+            cc3000_resolve_send(q, name ? name : url, namelen);
+        if ((ret = cc3000DnsQueryResult(q, ip)) != CC3000_DNS_PENDING)
+            break;
+        fired = cc3000WaiterWait(w, &dl);
+        if (!fired || (fired & CC3000_EV_CANCEL))
+            break;
+    }
+    cc3000WaiterPut(w);
+    return ret;
+}
+
+/** @brief Primes the chip resolver once per link, on first use.
+ *  @details Right after association the first lookup on the chip fails and
+ *           UDP sends may be dropped until the resolver has run once. Instead
+ *           of paying for it in wifi_link(), the first sendto() or
+ *           gethostbyname() after the link issues the two uncached lookups
+ *           the driver has always used: one is not known to be enough. */
+static void cc3000_resolver_warmup(void) {
+    int i, q, cold;
+    uint32_t ip, start;
+
+    //test and clear in one step, so that only one caller primes
+    vosSemWait(sem);
+    cold = resolver_cold;
+    resolver_cold = 0;
+    vosSemSignal(sem);
+    if (!cold)
+        return;
+    start = vosMillis();
+    for (i = 0; i < CC3000_RESOLVER_WARMUP_LOOKUPS; i++) {
+        q = cc3000_resolve_submit((uint8_t *)"localhost", 9, CC3000_DNS_F_NOCACHE);
+        if (q >= 0 && cc3000_resolve_wait(q, NULL, 0, CC3000_RESOLVER_WARMUP_TIMEOUT, &ip) == CC3000_DNS_PENDING)
+            cc3000DnsQueryAbandon(q);
+    }
+    link_timing.warmup_ms = vosMillis() - start;
+}
+
+static void cc3000_connect_send(int32_t sock, NetAddress *addr) {
+    sockaddr vmSocketAddr;
+
+    cc3000_prepare_addr(&vmSocketAddr, addr);
+    vosSemWait(sem);
+    connect_send(sock, &vmSocketAddr, sizeof(vmSocketAddr));
+    vosSemSignal(sem);
+}
+
+/** @brief Sends the queued connect of @p sock if its turn has come. */
+static void cc3000_connect_kick(int32_t sock) {
+    NetAddress addr;
+
+    if (cc3000ConnClaim(sock, &addr))
+        cc3000_connect_send(sock, &addr);
+}
+
+/** @brief Issues a connect of @p sock to @p addr without waiting for the handshake.
+ *  @details The connect is queued while another one is in flight on the chip:
+ *           cc3000_connect_wait() and select() send it when its turn comes.
+ *  @return 0, or -1 if a connect is already in flight on @p sock. */
+static int cc3000_connect_submit(int32_t sock, NetAddress *addr) {
+    int send;
+
+    if (cc3000ConnStart(sock, addr, &send) < 0)
+        return -1;
+    if (send)
+        cc3000_connect_send(sock, addr);
+    return 0;
+}
+
+/** @brief Waits up to @p timeout ms for the connect on @p sock to complete.
+ *  @return The cc3000ConnState() of @p sock. */
+static int cc3000_connect_wait(int32_t sock, uint32_t timeout) {
+    cc3000Deadline dl;
+    cc3000Waiter *w;
+    uint32_t fired;
+    int ret;
+
+    cc3000DeadlineStart(&dl, timeout);
+    w = cc3000WaiterGet(CC3000_EV_SOCK_CONNECT);
+    while (1) {
+        cc3000_connect_kick(sock);
+        if ((ret = cc3000ConnState(sock)) != CC3000_CONN_PENDING)
+            break;
+        fired = cc3000WaiterWait(w, &dl);
+        if (!fired || (fired & CC3000_EV_CANCEL))
+            break;
+    }
+    cc3000WaiterPut(w);
+    return ret;
+}
+
+/** @brief Moves the sockets of @p cfd whose connect has completed to @p wres
+ *         (connected) or @p xres (failed).
+ *  @return The number of sockets moved. */
+static int cc3000_select_connects(fd_set *cfd, int32_t maxsd, fd_set *wres, fd_set *xres) {
+    int32_t i;
+    int ready = 0;
+
+    for (i = 0; i <= maxsd; i++) {
+        if (!FD_ISSET(i, cfd))
+            continue;
+        cc3000_connect_kick(i);
+        switch (cc3000ConnState(i)) {
+            case CC3000_CONN_DONE:
+                FD_SET(i, wres);
+                ready++;
+                break;
+            case CC3000_CONN_FAILED:
+                FD_SET(i, xres);
+                ready++;
+                break;
+        }
+    }
+    return ready;
+}
+
+/** @brief Closes @p sock and drops it from the driver tables. */
+static void cc3000_net_close(int32_t sock) {
+    vosSemWait(sem);
+    closesocket(sock);
+    vosSemSignal(sem);
+    cc3000ConnRelease(sock);
+    cc3000_socket_drop(sock);
+}
+
+int cc3000_net_send(int32_t sock, uint8_t *buf, uint32_t len, uint32_t flags) {
+    int res = 0, tsnd, wrt = 0;
+    vosSemWait(sem);
+    printf("cc3000 sending %i bytes to %i\r\n", len, sock);
+
+    while (wrt < len) {
+        tsnd = len - wrt;
+        tsnd = tsnd < 64 ? tsnd : 64;
+        res = send(sock, buf + wrt, tsnd, flags);
+        if (res <= 0)
+            break;
+        printf("cc3000 sent %i of %i of %i/%i\n", res, tsnd, wrt, len);
+        wrt += res;
+    }
+    vosSemSignal(sem);
+    cc3000_socket_count(sock, 0, wrt);
+    return wrt;
+}
+
+int cc3000_net_sendto(int32_t sock, uint8_t *buf, uint32_t len, uint32_t flags, NetAddress *addr) {
+    sockaddr vmSocketAddr;
+    int res;
+    printf("sending_to: %i.%i.%i.%i:%i\r\n", OAL_IP_AT(addr->ip, 0), OAL_IP_AT(addr->ip, 1), OAL_IP_AT(addr->ip, 2),
+           OAL_IP_AT(addr->ip, 3), OAL_GET_NETPORT(addr->port));
+    cc3000_prepare_addr(&vmSocketAddr, addr);
+    cc3000_resolver_warmup();
+    vosSemWait(sem);
+    res = sendto(sock, buf, len, flags, &vmSocketAddr, sizeof(sockaddr));
+    vosSemSignal(sem);
+    cc3000_socket_count(sock, 0, res);
+    printf("out of sendto\n");
+    return res;
+}
+
+int cc3000_net_available(int32_t sock, int32_t timeout);
+
+/** @brief Starts the deadline of a read on @p sock: its SOCKOPT_RECV_TIMEOUT,
+ *         or none when it was never set, as on the chip. */
+static void cc3000_net_recv_deadline(int32_t sock, cc3000Deadline *dl) {
+    cc3000Socket *s = cc3000_socket_get(sock);
+    cc3000DeadlineStart(dl, (s && s->rcvtimeo) ? s->rcvtimeo : CC3000_WAIT_FOREVER);
+}
+
+/** @brief Waits, without the driver semaphore, until @p sock has data or @p dl expires.
+ *  @details The chip sends no event for incoming data, and its blocking
+ *           select() would hold the semaphore for the whole wait, so data is
+ *           found by polling. Only a FIN from the peer or cancel() wake the
+ *           waiter at once. The poll interval starts at
+ *           #CC3000_RECV_POLL_TIME, so a reply to a request just sent is
+ *           picked up within a few milliseconds, and doubles up to
+ *           #CC3000_RECV_POLL_MAX, so an idle reader costs at most a dozen
+ *           SPI round trips a second. Reads issued after this do not block
+ *           inside the chip with the semaphore held.
+ *  @return 1 when readable, -1 when closed or invalid, RECV_TIMED_OUT on
+ *          expiry or cancel. */
+static int cc3000_net_wait_readable(int32_t sock, cc3000Deadline *dl) {
+    cc3000Deadline poll;
+    cc3000Waiter *w;
+    uint32_t left, interval = CC3000_RECV_POLL_TIME;
+    int rb;
+
+    w = cc3000WaiterGetSocket(CC3000_EV_SOCK_CLOSE, sock);
+    while ((rb = cc3000_net_available(sock, 0)) == 0) {
+        left = cc3000DeadlineRemaining(dl);
+        if (!left) {
+            rb = RECV_TIMED_OUT;
+            break;
+        }
+        cc3000DeadlineStart(&poll, left < interval ? left : interval);
+        if (cc3000WaiterWait(w, &poll) & CC3000_EV_CANCEL) {
+            rb = RECV_TIMED_OUT;
+            break;
+        }
+        if (interval < CC3000_RECV_POLL_MAX)
+            interval *= 2;
+    }
+    cc3000WaiterPut(w);
+    return rb;
+}
+
+int cc3000_net_recv(int32_t sock, uint8_t *buf, uint32_t len, uint32_t flags) {
+    int rb = 0, ready;
+    int rrt = 0, tbr = 0;
+    cc3000Deadline dl;
+
+    printf("recv!\n");
+    //the peer closed: only read what the chip still buffers, then report EOF
+    if (cc3000_socket_eof(sock) && cc3000_net_available(sock, 0) <= 0)
+        return 0;
+    cc3000_net_recv_deadline(sock, &dl);
+    while (rrt < len) {
+        ready = cc3000_net_wait_readable(sock, &dl);
+        if (ready == RECV_TIMED_OUT) {
+            if (!rrt)
+                rrt = RECV_TIMED_OUT;
+            break;
+        }
+        if (ready < 0)
+            break;
+        tbr = ((len-rrt)>32) ? 32:(len-rrt);
+        vosSemWait(sem);
+        rb = recv(sock, buf+rrt, tbr, flags);
+        if (rb < 0 && rb != RECV_TIMED_OUT) {
+            closesocket(sock);
+            cc3000_socket_drop(sock);
+        }
+        vosSemSignal(sem);
+        if (rb < 0) {
+            if (rb == RECV_TIMED_OUT)
+                rrt=-rb;
+            break;
+        }
+        rrt+=rb;
+        cc3000_socket_count(sock, rb, 0);
+        if (!rb && cc3000_socket_eof(sock))
+            break;
+    }
+    printf("recv: %i read %i\r\n", rrt, buf[0]);
+    return rrt;
+}
+
+int cc3000_net_available(int32_t sock, int32_t timeout) {
+    fd_set readfd;
+    struct timeval tm;
+    cc3000Deadline dl;
+    FD_ZERO ( &readfd );
+    FD_SET  ( (sock), &readfd);
+
+    cc3000DeadlineStart(&dl, timeout);
+    cc3000DeadlineToTimeval(&dl, &tm);
+
+    vosSemWait(sem);
+    int retval = select( (sock + 1), &readfd, NULL, NULL, &tm );
+    vosSemSignal(sem);
+
+    if ( (retval > 0) && (FD_ISSET((sock), &readfd)) ) {
+        return 1;
+    } else if (!cc3000_is_socket_valid(sock) || cc3000_socket_eof(sock)) {
+        return -1;
+    } else {
+        return 0;
+    }
+}
+
+int cc3000_net_recvfrom(int32_t sock, uint8_t *buf, uint32_t len, uint32_t flags, NetAddress *addr) {
+    sockaddr vmSocketAddr;
+    socklen_t tlen;
+    int rb;
+    cc3000Deadline dl;
+
+    printf("recvfrom %i, %x,%i\n", sock, buf, len);
+    cc3000_net_recv_deadline(sock, &dl);
+    if (cc3000_net_wait_readable(sock, &dl) == RECV_TIMED_OUT)
+        return RECV_TIMED_OUT;
+    vosSemWait(sem);
+    rb = recvfrom(sock, buf, len, flags, &vmSocketAddr, &tlen);
+    printf("recvfrom read %i\n", rb);
+    if (rb < 0) {
+        if (rb != RECV_TIMED_OUT) { // rb is 0 even on timeout...so...how am I supposed to differentiate the two cases? (closed socket/timeout)
+            closesocket(sock);
+            cc3000_socket_drop(sock);
+            rb = 0;
+        }
+    }
+    vosSemSignal(sem);
+    cc3000_socket_count(sock, rb, 0);
+    printf("out of recvfrom\n");
+    memcpy(&addr->ip, vmSocketAddr.sa_data + 2, 4);
+    memcpy(&addr->port, vmSocketAddr.sa_data, 2);
+    return rb;
+}
+
+/* =============================================================================
+     CNATIVES
+   ============================================================================= */
+
+
+C_NATIVE(cc3000_init) {
+    C_NATIVE_UNWARN();
+    int32_t spi_prph;
+    int32_t nss;
+    int32_t wen;
+    int32_t irq;
+    int32_t fast_boot;
+    int32_t rejoin_on;
+
+    printf("cc3000_init: parsing parameters\n");
+    if (parse_py_args("iiiiII", nargs, args, &spi_prph, &nss, &wen, &irq, 0, &fast_boot, 0, &rejoin_on) != 6)
+        return ERR_TYPE_EXC;
+#ifdef VIPER_CC3000_TINY_DRIVER
+    //no status query to tell a join of the chip from a failed one
+    rejoin_on = 0;
+#endif
+    rejoin.enabled = rejoin_on != 0;
+
+    //init vhal spi driver
+    vhalInitSPI(NULL);
+
+    printf("cc3000_init: calling init wlan\n");
+    if (cc3000WlanInit(spi_prph, nss, wen, irq, fast_boot) < 0)
+        return ERR_PERIPHERAL_ERROR_EXC;
+    printf("cc3000_init: creating semaphore\n");
+    cc3000DeadlineInit();
+    cc3000DnsInit();
+    cc3000ConnInit();
+    cc3000LinkInit();
+    cc3000ScanCacheInit();
+    cc3000ConfigInit();
+    cc3000NvCacheInit();
+    sem = vosSemCreate(1);
+    link_sem = vosSemCreate(1);
+    nvmem_buf_lock = vosSemCreate(1);
+#ifndef VIPER_CC3000_TINY_DRIVER
+    if (!scan_bg.lock) {
+        scan_bg.lock = vosSemCreate(1);
+        scan_bg.wake = vosSemCreate(0);
+    }
+#endif
+    RELEASE_GIL();
+
+    printf("cc3000 wlan init...\r\n");
+    vosSemWait(sem);
+    printf("cc3000 wlan init.....\r\n");
+    wlan_start(0);
+    rejoin.started = vosMillis();
+    cc3000BootMark(CC3000_BOOT_STARTED);
+    printf("cc3000 wlan init......\r\n");
+
+    //with rejoin the chip joins the last network by itself, right from wlan_start()
+    if (rejoin.enabled)
+        cc3000ConfigPolicy(0, 1, 1);
+    else
+        cc3000ConfigPolicy(0, 0, 0);
+    //the chip forgets the mask at every start
+    wlan_set_event_mask(event_mask);
+    cc3000BootMark(CC3000_BOOT_READY);
+    power.since = vosMillis();
+
+    vosSemSignal(sem);
+
+    //wlan_disconnect();
+    printf("cc3000 wlan init.......\r\n");
+    ACQUIRE_GIL();
+    return ERR_OK;
+}
+
+unsigned long intervalTime[16] = { 2000, 2000, 2000, 2000,  2000,
+                                   2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000, 2000
+
+                                 };
+
+_wlan_full_scan_results_args_t scan_res;
+
+/** @brief Scan in progress, consumed one entry at a time by scan_next(). */
+static struct {
+    uint8_t active;
+    uint8_t valid;          ///< The chip reported the table of this scan.
+    uint8_t old;            ///< The chip held a table from an earlier scan.
+    uint8_t old_bssid[6];   ///< First entry of that table, to tell it apart.
+    uint16_t old_time;
+    uint32_t old_num;
+    int32_t remaining;      ///< Entries of the table not fetched yet.
+    int32_t best_rssi;      ///< Of the linked network, for the BSSID hint.
+    cc3000Deadline dl;      ///< Duration of the scan plus settle time.
+    uint32_t entries;       ///< Entries returned so far.
+    uint32_t first_ms;      ///< From start to the first entry.
+    uint32_t last_ms;       ///< From start to the last entry returned.
+    uint32_t total_ms;      ///< From start to scan_stop().
+} scan;
+
+/** @brief Parameters given to wlan_ioctl_set_scan_params(), set by scan_profile(). */
+static struct {
+    uint32_t channels;      ///< Bit n-1 enables channel n.
+    uint32_t min_dwell;     ///< Milliseconds per channel.
+    uint32_t max_dwell;
+    uint32_t probes;        ///< Probe requests per channel, 0 for a passive scan.
+} scan_profile = {CC3000_SCAN_CHANNELS_ALL, 20, 100, 5};
+
+
+#ifndef VIPER_CC3000_TINY_DRIVER
+/** @brief Reads the next entry of the results table into #scan_res.
+ *  @return 1 if the chip holds a table, aged or not, 0 otherwise. */
+static int cc3000_scan_read(void) {
+    scan_res.num_networks = 0;
+    scan_res.scan_status = 2;
+    wlan_ioctl_get_scan_results(0, (uint8_t*)&scan_res);
+    return scan_res.scan_status <= 1 && scan_res.num_networks > 0;
+}
+
+/** @brief Whether the entry in #scan_res opens the table seen by cc3000_scan_begin(). */
+static int cc3000_scan_is_old(void) {
+    return scan.old && scan_res.num_networks == scan.old_num && scan_res.time == scan.old_time &&
+           memcmp(scan_res.bssid, scan.old_bssid, sizeof(scan.old_bssid)) == 0;
+}
+
+static void cc3000_scan_begin(uint32_t time) {
+    uint32_t i;
+
+    vosSemWait(sem);
+    //the chip serves the last table until the new one is ready: remember its
+    //first entry and read it to the end, so that the next read starts over
+    scan.old = cc3000_scan_read();
+    if (scan.old) {
+        scan.old_num = scan_res.num_networks;
+        scan.old_time = scan_res.time;
+        memcpy(scan.old_bssid, scan_res.bssid, sizeof(scan.old_bssid));
+        for (i = 1; i < scan.old_num; i++)
+            cc3000_scan_read();
+    }
+    wlan_ioctl_set_scan_params(time, scan_profile.min_dwell, scan_profile.max_dwell, scan_profile.probes,
+                               scan_profile.channels, -120, 0, 300, (unsigned long * ) &intervalTime);
+    vosSemSignal(sem);
+    scan.active = 1;
+    scan.valid = 0;
+    scan.remaining = 0;
+    scan.best_rssi = -1;
+    scan.entries = 0;
+    scan.first_ms = 0;
+    scan.last_ms = 0;
+    scan.total_ms = 0;
+    cc3000DeadlineStart(&scan.dl, time + CC3000_SCAN_SETTLE_TIME);
+}
+
+static void cc3000_scan_end(void) {
+    if (scan.active || !scan.total_ms)
+        scan.total_ms = vosMillis() - scan.dl.start;
+    scan.active = 0;
+    vosSemWait(sem);
+    //a stopped chip starts with periodic scans off
+    if (!power.asleep)
+        wlan_ioctl_set_scan_params(0, 20, 100, 5, CC3000_SCAN_CHANNELS_ALL, -120, 0, 300, (unsigned long * ) &intervalTime);
+    vosSemSignal(sem);
+}
+
+/** @brief Records a valid entry of the results table. */
+static void cc3000_scan_record(void) {
+    int32_t rssi = scan_res.rssi >> 1;
+
+    scan.last_ms = vosMillis() - scan.dl.start;
+    if (!scan.entries++)
+        scan.first_ms = scan.last_ms;
+    cc3000ScanCacheStore(scan_res.bssid, scan_res.ssid_name, scan_res.sec_ssidlen >> 2,
+                         scan_res.sec_ssidlen & 0x3, rssi);
+    //the strongest access point of the linked network is tried first at the next link
+    if (link_params.valid && link_params.bssid_src != LINK_BSSID_USER &&
+            (scan_res.sec_ssidlen >> 2) == link_params.sidlen &&
+            memcmp(scan_res.ssid_name, link_params.ssid, link_params.sidlen) == 0 &&
+            rssi > scan.best_rssi) {
+        scan.best_rssi = rssi;
+        memcpy(link_params.bssid, scan_res.bssid, sizeof(link_params.bssid));
+        link_params.bssid_src = LINK_BSSID_SCAN;
+    }
+}
+
+/** @brief Fetches the next valid entry of the results table.
+ *  @details The table is polled until the chip serves the one of this scan,
+ *           so the first entry comes as soon as there is one instead of after
+ *           the whole scan time. The global semaphore is held for one command at a time.
+ *  @return 1 with #scan_res filled, 0 when the scan has no more entries. */
+static int cc3000_scan_fetch(void) {
+    cc3000Waiter *w;
+    cc3000Deadline poll;
+    uint32_t left, i;
+    int found;
+
+    while (scan.active) {
+        if (scan.valid && scan.remaining <= 0) {
+            cc3000ScanCacheRefreshed();
+            break;
+        }
+        vosSemWait(sem);
+        //power_sleep() and done() stop the chip under the semaphore
+        if (power.asleep || !scan.active) {
+            vosSemSignal(sem);
+            break;
+        }
+        found = cc3000_scan_read();
+        if (found && !scan.valid && cc3000_scan_is_old()) {
+            //the earlier table again: the new one is not ready yet
+            for (i = 1; i < scan.old_num; i++)
+                cc3000_scan_read();
+            found = 0;
+        }
+        vosSemSignal(sem);
+        //aged entries, status 0, are part of the table as well
+        if (found) {
+            if (!scan.valid) {
+                scan.valid = 1;
+                scan.remaining = scan_res.num_networks;
+            }
+            scan.remaining--;
+            //entries no longer valid are skipped
+            if (!(scan_res.rssi & 1))
+                continue;
+            cc3000_scan_record();
+            return 1;
+        }
+        if (scan.valid || cc3000DeadlineExpired(&scan.dl))
+            break;
+        //not valid yet: poll again, unless cancelled
+        left = cc3000DeadlineRemaining(&scan.dl);
+        cc3000DeadlineStart(&poll, left < CC3000_SCAN_POLL_TIME ? left : CC3000_SCAN_POLL_TIME);
+        w = cc3000WaiterGet(CC3000_EV_CANCEL);
+        left = cc3000WaiterWait(w, &poll);
+        cc3000WaiterPut(w);
+        if (left & CC3000_EV_CANCEL)
+            break;
+    }
+    scan.active = 0;
+    return 0;
+}
+
+static void cc3000_roam_check(uint32_t since);
+
+/** @brief Scans every scan_bg.interval ms, unless a scan did it already,
+ *         and checks if a better access point is in range. */
+static int cc3000_scan_thread(void *arg) {
+    uint32_t since;
+    int scanned;
+
+    (void)arg;
+    while (1) {
+        vosSemWaitTimeout(scan_bg.wake, scan_bg.interval ? TIME_U(scan_bg.interval, MILLIS) : VTIME_INFINITE);
+        if (!scan_bg.interval || power.asleep || cc3000ScanCacheFresh(scan_bg.interval))
+            continue;
+        scanned = 0;
+        vosSemWait(scan_bg.lock);
+        //power_sleep() and done() may have run while this thread waited
+        if (scan_bg.interval && !power.asleep && !scan.active) {
+            cc3000_scan_begin(scan_bg.duration);
+            since = scan.dl.start;
+            while (cc3000_scan_fetch());
+            cc3000_scan_end();
+            scan_bg.runs++;
+            scanned = 1;
+        }
+        vosSemSignal(scan_bg.lock);
+        if (scanned)
+            cc3000_roam_check(since);
+    }
+    return 0;
+}
+
+C_NATIVE(cc3000_scan_start) {
+    C_NATIVE_UNWARN();
+    int32_t time;
+    if (parse_py_args("i", nargs, args, &time) != 1)
+        return ERR_TYPE_EXC;
+    if (time <= 0)
+        return ERR_VALUE_EXC;
+
+    printf("cc3000_scan %i\n", time);
+    RELEASE_GIL();
+    //a background scan in progress is let finish
+    vosSemWait(scan_bg.lock);
+    cc3000_scan_begin(time);
+    vosSemSignal(scan_bg.lock);
+    ACQUIRE_GIL();
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_scan_next) {
+    C_NATIVE_UNWARN();
+    PTuple *itpl;
+    int found;
+
+    RELEASE_GIL();
+    found = cc3000_scan_fetch();
+    ACQUIRE_GIL();
+
+    if (!found) {
+        *res = MAKE_NONE();
+        return ERR_OK;
+    }
+    itpl = ptuple_new(4, NULL);
+    PTUPLE_SET_ITEM(itpl, 0, pstring_new(scan_res.sec_ssidlen >> 2, scan_res.ssid_name));
+    PTUPLE_SET_ITEM(itpl, 1, PSMALLINT_NEW(scan_res.sec_ssidlen & 0x3));
+    PTUPLE_SET_ITEM(itpl, 2, PSMALLINT_NEW(scan_res.rssi >> 1));
+    PTUPLE_SET_ITEM(itpl, 3, pbytes_new(6, scan_res.bssid));
+    *res = itpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_scan_stop) {
+    C_NATIVE_UNWARN();
+    RELEASE_GIL();
+    cc3000_scan_end();
+    ACQUIRE_GIL();
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_scan_profile) {
+    C_NATIVE_UNWARN();
+    int32_t channels;
+    int32_t min_dwell;
+    int32_t max_dwell;
+    int32_t probes;
+    int32_t interval;
+    int i;
+
+    if (parse_py_args("IIIII", nargs, args,
+                      CC3000_SCAN_CHANNELS_ALL, &channels,
+                      20, &min_dwell,
+                      100, &max_dwell,
+                      5, &probes,
+                      2000, &interval) != 5)
+        return ERR_TYPE_EXC;
+    if (channels <= 0 || (channels & ~CC3000_SCAN_CHANNELS_ALL) || min_dwell <= 0 || max_dwell < min_dwell ||
+            probes < 0 || probes > CC3000_SCAN_MAX_PROBES || interval <= 0)
+        return ERR_VALUE_EXC;
+    scan_profile.channels = channels;
+    scan_profile.min_dwell = min_dwell;
+    scan_profile.max_dwell = max_dwell;
+    scan_profile.probes = probes;
+    for (i = 0; i < 16; i++)
+        intervalTime[i] = interval;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_scan_stats) {
+    C_NATIVE_UNWARN();
+    PTuple *tpl = psequence_new(PTUPLE, 5);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(scan.entries));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(scan.first_ms));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(scan.last_ms));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(scan.total_ms));
+    PTUPLE_SET_ITEM(tpl, 4, PSMALLINT_NEW(scan_bg.runs));
+    *res = tpl;
+    return ERR_OK;
+}
+C_NATIVE(cc3000_scan_cached) {
+    C_NATIVE_UNWARN();
+    int32_t max_age;
+    cc3000ScanEntry nets[CC3000_SCAN_CACHE_SIZE];
+    PList *lst;
+    PTuple *itpl;
+    int i, n;
+
+    if (parse_py_args("i", nargs, args, &max_age) != 1)
+        return ERR_TYPE_EXC;
+    //a negative age takes whatever is cached
+    if (max_age >= 0 && !cc3000ScanCacheFresh(max_age)) {
+        *res = MAKE_NONE();
+        return ERR_OK;
+    }
+    n = cc3000ScanCacheSnapshot(nets);
+    lst = plist_new(n, NULL);
+    for (i = 0; i < n; i++) {
+        itpl = ptuple_new(4, NULL);
+        PTUPLE_SET_ITEM(itpl, 0, pstring_new(nets[i].ssidlen, nets[i].ssid));
+        PTUPLE_SET_ITEM(itpl, 1, PSMALLINT_NEW(nets[i].sec));
+        PTUPLE_SET_ITEM(itpl, 2, PSMALLINT_NEW(nets[i].rssi));
+        PTUPLE_SET_ITEM(itpl, 3, pbytes_new(6, nets[i].bssid));
+        PLIST_SET_ITEM(lst, i, itpl);
+    }
+    *res = lst;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_scan_cache_config) {
+    C_NATIVE_UNWARN();
+    int32_t interval;
+    int32_t duration;
+    int32_t max_age;
+
+    if (parse_py_args("III", nargs, args,
+                      0, &interval,
+                      CC3000_SCAN_BG_DURATION, &duration,
+                      CC3000_SCAN_DEFAULT_MAX_AGE, &max_age) != 3)
+        return ERR_TYPE_EXC;
+    if (interval < 0 || duration <= 0 || max_age <= 0)
+        return ERR_VALUE_EXC;
+    cc3000ScanCacheConfig(max_age);
+    scan_bg.duration = duration;
+    scan_bg.interval = interval;
+    if (interval && !scan_bg.thread) {
+        scan_bg.thread = vosThCreate(CC3000_SCAN_BG_STACK, VOS_PRIO_NORMAL, cc3000_scan_thread, NULL, NULL);
+        vosThResume(scan_bg.thread);
+    }
+    vosSemSignal(scan_bg.wake);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_scan_cache_flush) {
+    C_NATIVE_UNWARN();
+    cc3000ScanCacheFlush();
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+#endif
+
+C_NATIVE(cc3000_done) {
+    C_NATIVE_UNWARN();
+    int failed;
+
+    RELEASE_GIL();
+#ifndef VIPER_CC3000_TINY_DRIVER
+    //a background scan in progress is let finish, and no other one starts
+    if (scan_bg.lock)
+        vosSemWait(scan_bg.lock);
+    scan_bg.interval = 0;
+#endif
+    vosSemWait(sem);
+    scan.active = 0;
+    //the chip must be running to take the cached NVMEM writes
+    failed = cc3000NvCacheFlush(-1, 0);
+    wlan_stop();
+    vosSemSignal(sem);
+#ifndef VIPER_CC3000_TINY_DRIVER
+    if (scan_bg.lock)
+        vosSemSignal(scan_bg.lock);
+#endif
+    ACQUIRE_GIL();
+    //the chip is stopped anyway, but the lost writes are reported
+    if (failed)
+        return ERR_IOERROR_EXC;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+
+/** @brief Waits for the link to reach @p state, or a later one.
+ *  @details Waiting for an address fails as soon as the association is lost.
+ *           Waiting for the association does not: the chip keeps trying and a
+ *           disconnect owed by a previous join may still come in.
+ *  @return 0, or -1 on timeout, cancel or loss of the association. */
+static int cc3000_link_wait(cc3000Waiter *w, int state, uint32_t timeout) {
+    cc3000Deadline dl;
+    uint32_t fired;
+    int cur;
+
+    cc3000DeadlineStart(&dl, timeout);
+    while ((cur = cc3000LinkState()) != state) {
+        if (state == CC3000_LINK_ASSOCIATED && cur == CC3000_LINK_IP_READY)
+            break;
+        if (state == CC3000_LINK_IP_READY && cur == CC3000_LINK_LOST)
+            return -1;
+        fired = cc3000WaiterWait(w, &dl);
+        if (!fired || (fired & CC3000_EV_CANCEL))
+            return -1;
+    }
+    return 0;
+}
+
+#ifndef VIPER_CC3000_TINY_DRIVER
+/** @brief Lets the chip finish a join it started by itself (fast connect or
+ *         profiles) after wlan_start().
+ *  @return 1 if it joined the network in #link_params, 0 if wlan_connect()
+ *          is needed. */
+static int cc3000_link_rejoined(cc3000Waiter *w) {
+    tNetappIpconfigRetArgs ipconfig;
+    int32_t status;
+    int other;
+
+    vosSemWait(sem);
+    status = wlan_ioctl_statusget();
+    vosSemSignal(sem);
+    if (status == CC3000_WLAN_STATUS_DISCONNECTED && cc3000LinkState() < CC3000_LINK_ASSOCIATED)
+        return 0;
+    if (cc3000_link_wait(w, CC3000_LINK_ASSOCIATED, CC3000_LINK_CONNECT_TIMEOUT) < 0)
+        return 0;
+    vosSemWait(sem);
+    netapp_ipconfig(&ipconfig);
+    other = memcmp(ipconfig.uaSSID, link_params.ssid, link_params.sidlen) != 0 ||
+            (link_params.sidlen < sizeof(ipconfig.uaSSID) && ipconfig.uaSSID[link_params.sidlen] != 0);
+    if (other) {
+        //joined some other stored network
+        wlan_disconnect();
+        cc3000LinkLeave();
+        cc3000AsyncData.connected = 0;
+        cc3000AsyncData.dhcp.present = 0;
+    }
+    vosSemSignal(sem);
+    return !other;
+}
+
+/** @brief Stores #link_params as the only profile, so that the chip can join
+ *         it by itself at the next start. WEP keys are left to fast connect. */
+static void cc3000_link_store_profile(void) {
+    uint8_t *bssid = link_params.bssid_src != LINK_BSSID_NONE ? link_params.bssid : NULL;
+    int32_t ret;
+
+    wlan_ioctl_del_profile(255);
+    if (cc3000_wifi_sec[link_params.sec] == WLAN_SEC_UNSEC)
+        ret = wlan_add_profile(WLAN_SEC_UNSEC, link_params.ssid, link_params.sidlen, bssid, 1, 0, 0, 0, NULL, 0);
+    else if (cc3000_wifi_sec[link_params.sec] != WLAN_SEC_WEP)
+        ret = wlan_add_profile(cc3000_wifi_sec[link_params.sec], link_params.ssid, link_params.sidlen, bssid, 1,
+                               0x18, 0x1e, 2, link_params.password, link_params.passlen);
+    else
+        ret = 0;
+    rejoin.stored = ret >= 0;
+}
+#endif
+
+/** @brief Associates with the network in #link_params and waits for DHCP.
+ *  @details Called with the GIL released. The global semaphore is taken only
+ *           around chip commands: sockets and other calls keep working while
+ *           the link state machine waits for the association and the address. */
+static int cc3000_link_up(void) {
+    uint32_t start, origin, assoc, ready;
+    cc3000LinkInfo info;
+    cc3000Waiter *w;
+    uint8_t *bssid;
+    int ret;
+
+    start = vosMillis();
+    link_timing.connect_ms = 0;
+    link_timing.dhcp_ms = 0;
+    link_timing.total_ms = 0;
+    link_timing.warmup_ms = 0;
+
+    vosSemWait(sem);
+    //past the lease time the address may belong to another host
+    if (power.lease_valid && (vosMillis() - power.lease_at) >= CC3000_DHCP_LEASE_TIME * 1000UL)
+        power.lease_valid = 0;
+    power.lease_applied = 0;
+    if (net_info_set) {
+        cc3000ConfigIp(net_ip.ip, net_mask.ip, net_gw.ip, net_dns.ip);
+        printf("dhcp off\n");
+    } else if (power.reuse_lease && power.lease_valid) {
+        cc3000ConfigIp(power.lease.ip, power.lease.mask, power.lease.gw, power.lease.dns);
+        power.lease_applied = 1;
+        printf("dhcp off, last lease\n");
+    } else {
+        //no static info set!
+        cc3000ConfigIp(0, 0, 0, 0);
+        printf("dhcp on\n");
+    }
+    /*
+    wlan_stop();
+    vosThSleep(TIME_U(200,MILLIS));
+    wlan_start(0);
+    wlan_ioctl_set_connection_policy(0, 0, 0);
+    */
+    vosSemSignal(sem);
+
+    //take the waiter before connecting, so that early events are not lost
+    w = cc3000WaiterGet(CC3000_EV_CONNECT | CC3000_EV_DISCONNECT | CC3000_EV_DHCP);
+    rejoin.warm = 0;
+    roam.known = 0;
+#ifndef VIPER_CC3000_TINY_DRIVER
+    if (rejoin.enabled)
+        rejoin.warm = cc3000_link_rejoined(w);
+#endif
+    if (!rejoin.warm) {
+        bssid = link_params.bssid_src != LINK_BSSID_NONE ? link_params.bssid : NULL;
+        cc3000LinkJoin();
+        vosSemWait(sem);
+        ret = wlan_connect(cc3000_wifi_sec[link_params.sec], link_params.ssid, link_params.sidlen, bssid,
+                           link_params.password, link_params.passlen);
+        vosSemSignal(sem);
+        printf("cc3000 wlan link...\n");
+        if (ret == 0)
+            ret = cc3000_link_wait(w, CC3000_LINK_ASSOCIATED, CC3000_LINK_CONNECT_TIMEOUT);
+        //the access point in use is known only for a pinned join
+        roam.known = ret == 0 && bssid;
+        if (roam.known)
+            memcpy(roam.bssid, bssid, sizeof(roam.bssid));
+        if (ret != 0 && bssid) {
+            //the hinted access point is gone: let the chip pick one
+            link_params.bssid_src = LINK_BSSID_NONE;
+            vosSemWait(sem);
+            wlan_disconnect();
+            cc3000LinkJoin();
+            ret = wlan_connect(cc3000_wifi_sec[link_params.sec], link_params.ssid, link_params.sidlen, NULL,
+                               link_params.password, link_params.passlen);
+            vosSemSignal(sem);
+            if (ret == 0)
+                ret = cc3000_link_wait(w, CC3000_LINK_ASSOCIATED, CC3000_LINK_CONNECT_TIMEOUT);
+        }
+        if (ret != 0) {
+            cc3000WaiterPut(w);
+            return ERR_IOERROR_EXC;
+        }
+    }
+
+    printf("cc3000 wlan link.....\n");
+    if (cc3000_link_wait(w, CC3000_LINK_IP_READY, CC3000_LINK_DHCP_TIMEOUT) < 0) {
+        cc3000WaiterPut(w);
+        return ERR_IOERROR_EXC;
+    }
+    cc3000WaiterPut(w);
+    //phases are timed at the events, not at the wake up of this thread; a
+    //warm join runs since wlan_start(), so both events may precede this call
+    cc3000LinkGet(&info);
+    origin = rejoin.warm ? rejoin.started : start;
+    assoc = info.entered[CC3000_LINK_ASSOCIATED];
+    if ((int32_t)(assoc - origin) < 0)
+        assoc = origin;
+    ready = info.entered[CC3000_LINK_IP_READY];
+    if ((int32_t)(ready - assoc) < 0)
+        ready = assoc;
+    link_timing.connect_ms = assoc - origin;
+    link_timing.dhcp_ms = ready - assoc;
+    printf("cc3000 init...ok\r\n");
+    //vosThSleep(TIME_U(100,MILLIS));
+
+    vosSemWait(sem);
+    //dhcp, arp, keepalive and inactivity timeouts: sent only when changed
+    if (cc3000ConfigTimeouts(CC3000_DHCP_LEASE_TIME, 3600, 30, 0) != 0) {
+        vosSemSignal(sem);
+        printf("cc3000_init: can't set timeouts\r\n");
+        return ERR_TYPE_EXC;
+    }
+#ifndef VIPER_CC3000_TINY_DRIVER
+    //a join the chip did by itself proves the stored profile good
+    if (rejoin.enabled && !rejoin.warm && !rejoin.stored)
+        cc3000_link_store_profile();
+#endif
+    //the resolver still needs priming before the first lookup or udp send: done lazily
+    resolver_cold = 1;
+    vosSemSignal(sem);
+    link_timing.total_ms = vosMillis() - start;
+    if (rejoin.warm)
+        rejoin.warm_ms = vosMillis() - rejoin.started;
+    else
+        rejoin.cold_ms = link_timing.total_ms;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_wifi_link) {
+    C_NATIVE_UNWARN();
+    uint8_t *ssid;
+    int sidlen;
+    int sec;
+    uint8_t *password;
+    int passlen;
+    uint8_t *bssid;
+    int bssidlen;
+    int ret;
+
+    if (parse_py_args("siss", nargs, args, &ssid, &sidlen, &sec, &password, &passlen, &bssid, &bssidlen) != 4)
+        return ERR_TYPE_EXC;
+    if (sec < 0 || sec > 3 || sidlen > sizeof(link_params.ssid) || passlen > sizeof(link_params.password))
+        return ERR_VALUE_EXC;
+    if (bssidlen != 0 && bssidlen != sizeof(link_params.bssid))
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    //power_wake() and the roaming check read the parameters under link_sem
+    vosSemWait(link_sem);
+    if (!link_params.valid || link_params.sec != sec || link_params.sidlen != sidlen ||
+            link_params.passlen != passlen || memcmp(link_params.ssid, ssid, sidlen) != 0 ||
+            memcmp(link_params.password, password, passlen) != 0) {
+        //another network: hints and the stored profile are stale
+        link_params.bssid_src = LINK_BSSID_NONE;
+        rejoin.stored = 0;
+    }
+    if (bssidlen) {
+        memcpy(link_params.bssid, bssid, bssidlen);
+        link_params.bssid_src = LINK_BSSID_USER;
+    }
+
+    //kept for power_wake()
+    link_params.sec = sec;
+    link_params.sidlen = sidlen;
+    link_params.passlen = passlen;
+    memcpy(link_params.ssid, ssid, sidlen);
+    memcpy(link_params.password, password, passlen);
+    link_params.valid = 1;
+
+    ret = cc3000_link_up();
+    vosSemSignal(link_sem);
+    ACQUIRE_GIL();
+    //vbl_printf_stdout("wifi_link\n");
+    return ret;
+}
+
+C_NATIVE(cc3000_link_stats) {
+    C_NATIVE_UNWARN();
+    PTuple *tpl = psequence_new(PTUPLE, 7);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(link_timing.connect_ms));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(link_timing.dhcp_ms));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(link_timing.total_ms));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(rejoin.warm));
+    PTUPLE_SET_ITEM(tpl, 4, PSMALLINT_NEW(rejoin.cold_ms));
+    PTUPLE_SET_ITEM(tpl, 5, PSMALLINT_NEW(rejoin.warm_ms));
+    PTUPLE_SET_ITEM(tpl, 6, PSMALLINT_NEW(link_timing.warmup_ms));
+    *res = tpl;
+    return ERR_OK;
+}
+
+#ifndef VIPER_CC3000_TINY_DRIVER
+/** @brief Connects the pooled peers again after a roam, as power_wake() does.
+ *  @details The sockets are listed in #roam and parked by the next pool call,
+ *           which holds the GIL. */
+static void cc3000_roam_reconnect(NetAddress *peers, int npeers) {
+    int32_t sock;
+    int i;
+
+    for (i = 0; i < npeers; i++) {
+        sock = cc3000_net_socket(SOCK_STREAM, IPPROTO_TCP);
+        if (sock < 0)
+            break;
+        cc3000_socket_open(sock, DRV_SOCK_STREAM);
+        if (cc3000_connect_submit(sock, &peers[i]) < 0) {
+            cc3000_net_close(sock);
+            continue;
+        }
+        socks[sock].peer = peers[i];
+        vosSemWait(sem);
+        roam.opened |= 1 << sock;
+        roam.opened_at = vosMillis();
+        vosSemSignal(sem);
+    }
+}
+
+/** @brief Moves to a stronger access point of the linked network.
+ *  @details Called by the scan thread with the entries seen since @p since
+ *           in the scan cache. The current access point must be known, as
+ *           the chip does not report the BSSID it joined: it is after a join
+ *           pinned by link(bssid) or by a scan hint.
+ *
+ *           A roam breaks every TCP connection: the chip drops them with the
+ *           association. Open stream sockets are marked eof, and the pooled
+ *           peers are connected again once the new link is up. */
+static void cc3000_roam_check(uint32_t since) {
+    cc3000ScanEntry nets[CC3000_SCAN_CACHE_SIZE];
+    cc3000ScanEntry *cur = NULL, *best = NULL;
+    NetAddress peers[CC3000_MAX_SD];
+    uint32_t start;
+    int32_t sd;
+    int i, n, ret, npeers = 0;
+
+    if (!roam.enabled || !link_params.valid || cc3000LinkState() != CC3000_LINK_IP_READY)
+        return;
+    n = cc3000ScanCacheSnapshot(nets);
+    for (i = 0; i < n; i++) {
+        if ((int32_t)(nets[i].seen - since) < 0 || nets[i].ssidlen != link_params.sidlen ||
+                memcmp(nets[i].ssid, link_params.ssid, link_params.sidlen) != 0)
+            continue;
+        if (roam.known && memcmp(nets[i].bssid, roam.bssid, 6) == 0)
+            cur = &nets[i];
+        else if (!best)
+            best = &nets[i];    //sorted, strongest first
+    }
+    roam.checks++;
+    if (cur)
+        roam.rssi = cur->rssi;
+    //an unknown or unheard current access point is left alone: the next
+    //scan hint pins the join if the link drops
+    if (!cur || !best || best->rssi < cur->rssi + roam.hysteresis)
+        return;
+
+    start = vosMillis();
+    vosSemWait(link_sem);
+    memcpy(link_params.bssid, best->bssid, sizeof(link_params.bssid));
+    link_params.bssid_src = LINK_BSSID_SCAN;
+    vosSemWait(sem);
+    wlan_disconnect();
+    cc3000LinkLeave();
+    //the connections are gone with the association
+    for (sd = 0; sd < CC3000_MAX_SD; sd++) {
+        if (!socks[sd].valid || socks[sd].type != DRV_SOCK_STREAM)
+            continue;
+        if (socks[sd].pool != POOL_FREE && !socks[sd].eof)
+            peers[npeers++] = socks[sd].peer;
+        socks[sd].eof = 1;
+    }
+    vosSemSignal(sem);
+    ret = cc3000_link_up();
+    vosSemSignal(link_sem);
+    if (ret == ERR_OK)
+        cc3000_roam_reconnect(peers, npeers);
+    roam.last_outage_ms = vosMillis() - start;
+    roam.total_outage_ms += roam.last_outage_ms;
+    roam.roams++;
+    if (ret != ERR_OK)
+        roam.failures++;
+}
+
+C_NATIVE(cc3000_roam_config) {
+    C_NATIVE_UNWARN();
+    int32_t enabled;
+    int32_t hysteresis;
+
+    if (parse_py_args("iI", nargs, args, &enabled, CC3000_ROAM_HYSTERESIS, &hysteresis) != 2)
+        return ERR_TYPE_EXC;
+    if (hysteresis < 0)
+        return ERR_VALUE_EXC;
+    roam.hysteresis = hysteresis;
+    roam.enabled = enabled != 0;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_roam_stats) {
+    C_NATIVE_UNWARN();
+    PTuple *tpl = psequence_new(PTUPLE, 6);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(roam.roams));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(roam.failures));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(roam.checks));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(roam.rssi));
+    PTUPLE_SET_ITEM(tpl, 4, PSMALLINT_NEW(roam.last_outage_ms));
+    PTUPLE_SET_ITEM(tpl, 5, PSMALLINT_NEW(roam.total_outage_ms));
+    *res = tpl;
+    return ERR_OK;
+}
+#endif
+
+C_NATIVE(cc3000_link_state) {
+    C_NATIVE_UNWARN();
+    cc3000LinkInfo info;
+    PTuple *tpl = psequence_new(PTUPLE, 3);
+
+    cc3000LinkGet(&info);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(info.state));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(vosMillis() - info.entered[info.state]));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(info.losses));
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_link_wait_state) {
+    C_NATIVE_UNWARN();
+    int32_t state;
+    int32_t timeout;
+    cc3000Deadline dl;
+    cc3000Waiter *w;
+    uint32_t fired;
+
+    if (parse_py_args("iI", nargs, args, &state, -1, &timeout) != 2)
+        return ERR_TYPE_EXC;
+    if (state < 0 || state >= CC3000_LINK_STATES)
+        return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    w = cc3000WaiterGet(CC3000_EV_CONNECT | CC3000_EV_DISCONNECT | CC3000_EV_DHCP);
+    cc3000DeadlineStart(&dl, timeout < 0 ? CC3000_WAIT_FOREVER : timeout);
+    while (cc3000LinkState() != state) {
+        fired = cc3000WaiterWait(w, &dl);
+        if (!fired || (fired & CC3000_EV_CANCEL))
+            break;
+    }
+    cc3000WaiterPut(w);
+    ACQUIRE_GIL();
+    *res = PSMALLINT_NEW(cc3000LinkState());
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_nvmem_read) {
+    C_NATIVE_UNWARN();
+    int32_t fileid;
+    int32_t offset;
+    int32_t len;
+    PObject *buf;
+    int32_t ret;
+
+    if (parse_py_args("iii", nargs, args, &fileid, &offset, &len) != 3)
+        return ERR_TYPE_EXC;
+    if (fileid < 0 || fileid >= NVMEM_MAX_ENTRY || offset < 0 || len <= 0 || len > CC3000_NVMEM_MAX_LEN)
+        return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    vosSemWait(nvmem_buf_lock);
+    //one hold of the transport for the whole file
+    vosSemWait(sem);
+    ret = nvmem_read_stream(fileid, len, offset, nvmem_buf);
+    vosSemSignal(sem);
+    ACQUIRE_GIL();
+    if (ret == 0) {
+        buf = psequence_new(PBYTES, len);
+        memcpy(PSEQUENCE_BYTES(buf), nvmem_buf, len);
+    }
+    vosSemSignal(nvmem_buf_lock);
+    if (ret != 0)
+        return ERR_IOERROR_EXC;
+    *res = buf;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_nvmem_write) {
+    C_NATIVE_UNWARN();
+    int32_t fileid;
+    int32_t offset;
+    uint8_t *data;
+    int32_t len;
+    int32_t ret;
+
+    if (parse_py_args("iis", nargs, args, &fileid, &offset, &data, &len) != 3)
+        return ERR_TYPE_EXC;
+    //system files are left to the patch programmer
+    if (fileid < CC3000_NVMEM_USER_FIRST || fileid > CC3000_NVMEM_USER_LAST || offset < 0 ||
+            len > CC3000_NVMEM_MAX_LEN)
+        return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    vosSemWait(sem);
+    ret = nvmem_write_stream(fileid, len, offset, data);
+    vosSemSignal(sem);
+    ACQUIRE_GIL();
+    if (ret != 0)
+        return ERR_IOERROR_EXC;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_nvmem_create) {
+    C_NATIVE_UNWARN();
+    int32_t fileid;
+    int32_t len;
+    int32_t ret;
+
+    if (parse_py_args("ii", nargs, args, &fileid, &len) != 2)
+        return ERR_TYPE_EXC;
+    if (fileid < CC3000_NVMEM_USER_FIRST || fileid > CC3000_NVMEM_USER_LAST || len < 0 ||
+            len > CC3000_NVMEM_MAX_LEN)
+        return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    vosSemWait(sem);
+    ret = nvmem_create_entry(fileid, len);
+    vosSemSignal(sem);
+    ACQUIRE_GIL();
+    if (ret != 0)
+        return ERR_IOERROR_EXC;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_patch_block) {
+    C_NATIVE_UNWARN();
+    int32_t fileid;
+    int32_t offset;
+    uint8_t *data;
+    int32_t len;
+    int32_t flags;
+    int ret;
+
+    if (parse_py_args("iisI", nargs, args, &fileid, &offset, &data, &len,
+            CC3000_PATCH_F_VERIFY | CC3000_PATCH_F_SKIP, &flags) != 4)
+        return ERR_TYPE_EXC;
+    if (!cc3000PatchFileValid(fileid) || offset < 0 || len > CC3000_NVMEM_MAX_LEN)
+        return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    vosSemWait(sem);
+    ret = cc3000PatchBlock(fileid, offset, data, len, flags);
+    vosSemSignal(sem);
+    ACQUIRE_GIL();
+    if (ret != 0)
+        return ERR_IOERROR_EXC;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_patch_start) {
+    C_NATIVE_UNWARN();
+    int32_t fileid;
+    int32_t len;
+    int32_t flags;
+    int ret;
+
+    if (parse_py_args("iiI", nargs, args, &fileid, &len,
+            CC3000_PATCH_F_VERIFY | CC3000_PATCH_F_SKIP, &flags) != 3)
+        return ERR_TYPE_EXC;
+    if (!cc3000PatchFileValid(fileid) || len <= 0)
+        return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    vosSemWait(sem);
+    ret = cc3000PatchStart(fileid, len, flags);
+    vosSemSignal(sem);
+    ACQUIRE_GIL();
+    if (ret != 0)
+        return ERR_IOERROR_EXC;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_patch_reset) {
+    C_NATIVE_UNWARN();
+    cc3000PatchReset();
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_patch_stats) {
+    C_NATIVE_UNWARN();
+    PTuple *tpl = psequence_new(PTUPLE, 6);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(cc3000PatchCounters.bytes));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(cc3000PatchCounters.written));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(cc3000PatchCounters.skipped));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(cc3000PatchCounters.verified));
+    PTUPLE_SET_ITEM(tpl, 4, PSMALLINT_NEW(cc3000PatchCounters.failures));
+    PTUPLE_SET_ITEM(tpl, 5, PSMALLINT_NEW(cc3000PatchCounters.ms));
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_sp_version) {
+    C_NATIVE_UNWARN();
+    uint8_t ver[2];
+    uint8_t ret;
+    PTuple *tpl;
+
+    RELEASE_GIL();
+    vosSemWait(sem);
+    ret = nvmem_read_sp_version(ver);
+    vosSemSignal(sem);
+    ACQUIRE_GIL();
+    if (ret != 0)
+        return ERR_IOERROR_EXC;
+    tpl = psequence_new(PTUPLE, 2);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(ver[0]));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(ver[1]));
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_nvcache_enable) {
+    C_NATIVE_UNWARN();
+    int32_t fileid;
+    int32_t size;
+    int ret;
+
+    if (parse_py_args("ii", nargs, args, &fileid, &size) != 2)
+        return ERR_TYPE_EXC;
+    if (fileid < CC3000_NVMEM_USER_FIRST || fileid > CC3000_NVMEM_USER_LAST || size < 0 ||
+            size > CC3000_NVCACHE_FILE_SIZE)
+        return ERR_VALUE_EXC;
+    RELEASE_GIL();
+    vosSemWait(sem);
+    ret = cc3000NvCacheEnable(fileid, size);
+    vosSemSignal(sem);
+    ACQUIRE_GIL();
+    if (ret != 0)
+        return ERR_IOERROR_EXC;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_nvcache_flush) {
+    C_NATIVE_UNWARN();
+    int32_t fileid;
+    int ret;
+
+    if (parse_py_args("I", nargs, args, -1, &fileid) != 1)
+        return ERR_TYPE_EXC;
+    RELEASE_GIL();
+    vosSemWait(sem);
+    ret = cc3000NvCacheFlush(fileid, 0);
+    vosSemSignal(sem);
+    ACQUIRE_GIL();
+    if (ret != 0)
+        return ERR_IOERROR_EXC;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_nvcache_stats) {
+    C_NATIVE_UNWARN();
+    int32_t fileid;
+    cc3000NvCacheSlot *s;
+    PTuple *tpl;
+
+    if (parse_py_args("i", nargs, args, &fileid) != 1)
+        return ERR_TYPE_EXC;
+    if (fileid < 0 || fileid >= CC3000_NVCACHE_FILES)
+        return ERR_VALUE_EXC;
+    s = cc3000NvCacheGet(fileid);
+    tpl = psequence_new(PTUPLE, 5);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(cc3000NvmemWrites[fileid]));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(s ? s->hits : 0));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(s ? s->loads : 0));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(s ? s->flushes : 0));
+    PTUPLE_SET_ITEM(tpl, 4, PSMALLINT_NEW(s ? s->dirty : 0));
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_config_stats) {
+    C_NATIVE_UNWARN();
+    PTuple *tpl = psequence_new(PTUPLE, 2);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(cc3000ConfigCounters.writes));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(cc3000ConfigCounters.skipped));
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_cancel) {
+    C_NATIVE_UNWARN();
+    //wake every thread blocked in a driver wait
+    cc3000WaitCancel(CC3000_EV_CANCEL);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_wifi_unlink) {
+
+    RELEASE_GIL();
+    vosSemWait(sem);
+    wlan_disconnect();
+    cc3000LinkLeave();
+    vosSemSignal(sem);
+    ACQUIRE_GIL();
+
+    return ERR_OK;
+}
+
+
+C_NATIVE(cc3000_power_sleep) {
+    C_NATIVE_UNWARN();
+    cc3000LinkInfo info;
+    NetAddress peers[CC3000_MAX_SD];
+    int32_t sd;
+    uint32_t now;
+    uint8_t stale;
+    int npeers, failed;
+
+    *res = MAKE_NONE();
+    if (power.asleep)
+        return ERR_OK;
+    //the chip loses its sockets: remember where the pooled ones were connected
+    cc3000_pool_adopt();
+    npeers = 0;
+    stale = 0;
+    for (sd = 0; sd < CC3000_MAX_SD; sd++) {
+        if (!socks[sd].valid)
+            continue;
+        if (socks[sd].pool != POOL_FREE && !socks[sd].eof)
+            peers[npeers++] = socks[sd].peer;
+        //parked sockets belong to the pool, the others to Python objects
+        if (socks[sd].pool != POOL_PARKED)
+            stale |= 1 << sd;
+    }
+    //a reused lease keeps the time it was first obtained at
+    if (!net_info_set && cc3000AsyncData.dhcp.present && !power.lease_applied) {
+        cc3000LinkGet(&info);
+        power.lease_at = info.entered[CC3000_LINK_IP_READY];
+        memcpy(&power.lease.ip, (void *)cc3000AsyncData.dhcp.info.aucIP, 4);
+        memcpy(&power.lease.mask, (void *)cc3000AsyncData.dhcp.info.aucSubnetMask, 4);
+        memcpy(&power.lease.gw, (void *)cc3000AsyncData.dhcp.info.aucDefaultGateway, 4);
+        memcpy(&power.lease.dns, (void *)cc3000AsyncData.dhcp.info.aucDNSServer, 4);
+        power.lease.ip = BLTSWAP32(power.lease.ip);
+        power.lease.mask = BLTSWAP32(power.lease.mask);
+        power.lease.gw = BLTSWAP32(power.lease.gw);
+        power.lease.dns = BLTSWAP32(power.lease.dns);
+        power.lease_valid = 1;
+    }
+
+    RELEASE_GIL();
+#ifndef VIPER_CC3000_TINY_DRIVER
+    //a background scan in progress is let finish, the next one sees the chip asleep
+    if (scan_bg.lock)
+        vosSemWait(scan_bg.lock);
+#endif
+    vosSemWait(sem);
+    //the chip must be running to take the cached NVMEM writes: it is left
+    //running, sockets and all, when they cannot be written back
+    failed = cc3000NvCacheFlush(-1, 0);
+    if (failed) {
+        vosSemSignal(sem);
+#ifndef VIPER_CC3000_TINY_DRIVER
+        if (scan_bg.lock)
+            vosSemSignal(scan_bg.lock);
+#endif
+        ACQUIRE_GIL();
+        return ERR_IOERROR_EXC;
+    }
+    wlan_stop();
+    power.asleep = 1;
+    scan.active = 0;
+    //the chip closed the held numbers too
+    stale_sds |= stale;
+    reserved_sds = 0;
+    cc3000LinkLeave();
+    //answers owed by the chip will never come
+    cc3000ConnInit();
+    cc3000DnsQueryReset();
+    vosSemSignal(sem);
+#ifndef VIPER_CC3000_TINY_DRIVER
+    if (scan_bg.lock)
+        vosSemSignal(scan_bg.lock);
+#endif
+    ACQUIRE_GIL();
+
+    for (sd = 0; sd < CC3000_MAX_SD; sd++) {
+        if (socks[sd].valid)
+            cc3000_socket_drop(sd);
+    }
+    memcpy(power.peers, peers, npeers * sizeof(NetAddress));
+    power.npeers = npeers;
+    now = vosMillis();
+    power.awake_ms = now - power.since;
+    power.since = now;
+    power.await_tx = 0;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_power_wake) {
+    C_NATIVE_UNWARN();
+    int32_t opened[CC3000_MAX_SD];
+    int32_t sock;
+    uint32_t start;
+    int i, nopened = 0;
+    int ret = ERR_OK;
+
+    if (!power.asleep) {
+        *res = PSMALLINT_NEW(0);
+        return ERR_OK;
+    }
+
+    RELEASE_GIL();
+    vosSemWait(link_sem);
+    vosSemWait(sem);
+    start = vosMillis();
+    power.sleep_ms = start - power.since;
+    power.since = start;
+    power.asleep = 0;
+    power.cycles++;
+    wlan_start(0);
+    rejoin.started = vosMillis();
+    //the connection policy is saved by the chip, the mask is not
+    wlan_set_event_mask(event_mask);
+    vosSemSignal(sem);
+    if (link_params.valid) {
+        ret = cc3000_link_up();
+        if (ret != ERR_OK && power.reuse_lease && power.lease_valid) {
+            //the lease may be gone: join again with DHCP
+            power.lease_valid = 0;
+            vosSemWait(sem);
+            wlan_disconnect();
+            cc3000LinkLeave();
+            vosSemSignal(sem);
+            ret = cc3000_link_up();
+        }
+    }
+    vosSemSignal(link_sem);
+
+    if (ret == ERR_OK) {
+        power.resume_ms = vosMillis() - start;
+        power.first_tx_ms = 0;
+        power.await_tx = 1;
+        //connect the pooled sockets again, pool_connect() collects the result
+        for (i = 0; i < power.npeers; i++) {
+            sock = cc3000_net_socket(SOCK_STREAM, IPPROTO_TCP);
+            if (sock < 0)
+                break;
+            cc3000_socket_open(sock, DRV_SOCK_STREAM);
+            if (cc3000_connect_submit(sock, &power.peers[i]) < 0) {
+                cc3000_net_close(sock);
+                continue;
+            }
+            socks[sock].peer = power.peers[i];
+            opened[nopened++] = sock;
+        }
+    }
+    power.npeers = 0;
+    ACQUIRE_GIL();
+
+    for (i = 0; i < nopened; i++) {
+        socks[opened[i]].pool = POOL_PARKED;
+        socks[opened[i]].idle_since = start;
+    }
+    if (ret != ERR_OK)
+        return ret;
+    *res = PSMALLINT_NEW(power.resume_ms);
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_power_config) {
+    C_NATIVE_UNWARN();
+    int32_t reuse_lease;
+    int32_t active_ua;
+    int32_t sleep_ua;
+
+    if (parse_py_args("III", nargs, args,
+                      0, &reuse_lease,
+                      CC3000_POWER_ACTIVE_UA, &active_ua,
+                      CC3000_POWER_SLEEP_UA, &sleep_ua) != 3)
+        return ERR_TYPE_EXC;
+    if (active_ua < 0 || sleep_ua < 0)
+        return ERR_VALUE_EXC;
+    power.reuse_lease = reuse_lease != 0;
+    power.active_ua = active_ua;
+    power.sleep_ua = sleep_ua;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_power_stats) {
+    C_NATIVE_UNWARN();
+    uint64_t charge;
+    PTuple *tpl = psequence_new(PTUPLE, 6);
+
+    //uA * ms = nC
+    charge = (uint64_t)power.awake_ms * power.active_ua + (uint64_t)power.sleep_ms * power.sleep_ua;
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(power.cycles));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(power.resume_ms));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(power.first_tx_ms));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(power.awake_ms));
+    PTUPLE_SET_ITEM(tpl, 4, PSMALLINT_NEW(power.sleep_ms));
+    PTUPLE_SET_ITEM(tpl, 5, PSMALLINT_NEW((uint32_t)(charge / 1000)));
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_sendto) {
+    C_NATIVE_UNWARN();
+    uint8_t *buf;
+    int32_t len;
+    int32_t flags;
+    int32_t sock;
+    NetAddress addr;
+    printf("In cc3000_sendto\n");
+    if (parse_py_args("isni", nargs, args,
+                      &sock,
+                      &buf, &len,
+                      &addr,
+                      &flags) != 4) return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock))
+        return ERR_IOERROR_EXC;
+
+    printf("In cc3000_sendto2\n");
+    RELEASE_GIL();
+
+    sock = cc3000_net_sendto(sock, buf, len, flags, &addr);
+
+    ACQUIRE_GIL();
+    printf("In cc3000_sendto3\n");
+
+    if (sock < 0) {
+        return ERR_IOERROR_EXC;
+    }
+    *res = PSMALLINT_NEW(sock);
+
+
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_send) {
+    C_NATIVE_UNWARN();
+    uint8_t *buf;
+    int32_t len;
+    int32_t flags;
+    int32_t sock;
+    if (parse_py_args("isi", nargs, args,
+                      &sock,
+                      &buf, &len,
+                      &flags) != 3) return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock))
+        return ERR_IOERROR_EXC;
+    RELEASE_GIL();
+    sock = cc3000_net_send(sock, buf, len, flags);
+    ACQUIRE_GIL();
+    if (sock < 0) {
+        return ERR_IOERROR_EXC;
+    }
+    *res = PSMALLINT_NEW(sock);
+    return ERR_OK;
+}
+
+
+C_NATIVE(cc3000_sendall) {
+    C_NATIVE_UNWARN();
+    uint8_t *buf;
+    int32_t len;
+    int32_t flags;
+    int32_t sock;
+    int32_t tres = 0;
+    if (parse_py_args("isi", nargs, args,
+                      &sock,
+                      &buf, &len,
+                      &flags) != 3) return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock))
+        return ERR_IOERROR_EXC;
+    RELEASE_GIL();
+    while (len > 0) {
+        printf("sendall: remaining %i at %x\n", len, buf);
+        tres = cc3000_net_send(sock, buf, len, flags);
+        printf("sendall: sent %i\n", tres);
+        if (tres < 0) {
+            break;
+        }
+        len -= tres;
+        buf += tres;
+    }
+
+    ACQUIRE_GIL();
+    if (tres < 0) {
+        return ERR_IOERROR_EXC;
+    }
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_recv_into) {
+    C_NATIVE_UNWARN();
+    uint8_t *buf;
+    int32_t len;
+    int32_t sz;
+    int32_t flags;
+    int32_t ofs;
+    int32_t sock;
+    if (parse_py_args("isiiI", nargs, args,
+                      &sock,
+                      &buf, &len,
+                      &sz,
+                      &flags,
+                      0,
+                      &ofs
+                     ) != 5) return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock))
+        return ERR_IOERROR_EXC;
+    buf += ofs;
+    len -= ofs;
+    len = (sz < len) ? sz : len;
+    RELEASE_GIL();
+    sock = cc3000_net_recv(sock, buf, len, flags);
+    ACQUIRE_GIL();
+
+    if (sock < 0) {
+        if (sock == RECV_TIMED_OUT)
+            return ERR_TIMEOUT_EXC;
+        return ERR_IOERROR_EXC;
+    }
+    *res = PSMALLINT_NEW(sock);
+
+    return ERR_OK;
+}
+
+
+
+C_NATIVE(cc3000_recvfrom_into) {
+    C_NATIVE_UNWARN();
+    uint8_t *buf;
+    int32_t len;
+    int32_t sz;
+    int32_t flags;
+    int32_t ofs;
+    int32_t sock;
+    NetAddress addr;
+    if (parse_py_args("isiiI", nargs, args,
+                      &sock,
+                      &buf, &len,
+                      &sz,
+                      &flags,
+                      0,
+                      &ofs
+                     ) != 5) return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock))
+        return ERR_IOERROR_EXC;
+    buf += ofs;
+    len -= ofs;
+    len = (sz < len) ? sz : len;
+
+    RELEASE_GIL();
+    addr.ip = 0;
+    sock = cc3000_net_recvfrom(sock, buf, len, flags, &addr);
+    ACQUIRE_GIL();
+
+    if (sock < 0) {
+        if (sock == RECV_TIMED_OUT)
+            return ERR_TIMEOUT_EXC;
+        return ERR_IOERROR_EXC;
+    }
+    PTuple *tpl = (PTuple *) psequence_new(PTUPLE, 2);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(sock));
+    PObject *ipo = netaddress_to_object(&addr);
+    PTUPLE_SET_ITEM(tpl, 1, ipo);
+    *res = tpl;
+
+    return ERR_OK;
+}
+
+/** @brief Waits until a socket of @p rfd, @p wfd or @p xfd is ready, for at
+ *         most @p timeout ms (negative: no timeout). Called without the GIL.
+ *  @details The sets are replaced by the ready sockets. Sockets with a tracked
+ *           connect are answered by the connect tracker and sockets closed by
+ *           the peer are readable (EOF), both without asking the chip.
+ *  @return The number of ready sockets, or a negative value on error. */
+static int cc3000_net_select(int32_t maxsd, fd_set *rfd, fd_set *wfd, fd_set *xfd, int32_t timeout) {
+    fd_set cfd, efd;
+    struct timeval tms;
+    struct timeval *ptm;
+    int32_t i, tmp, nconn, neof, others;
+    uint32_t m;
+
+    FD_ZERO(&cfd);
+    FD_ZERO(&efd);
+    nconn = 0;
+    neof = 0;
+    others = 0;
+    for (i = 0; i <= maxsd; i++) {
+        if (FD_ISSET(i, wfd) && cc3000ConnState(i) != CC3000_CONN_NONE) {
+            FD_CLR(i, wfd);
+            FD_SET(i, &cfd);
+            nconn++;
+        }
+        if (FD_ISSET(i, rfd) && cc3000_socket_eof(i)) {
+            FD_CLR(i, rfd);
+            FD_SET(i, &efd);
+            neof++;
+        }
+        if (FD_ISSET(i, rfd) || FD_ISSET(i, wfd) || FD_ISSET(i, xfd))
+            others++;
+    }
+
+    //something is ready already: just poll the others
+    if (neof)
+        timeout = 0;
+    if (timeout >= 0) {
+        tms.tv_sec = timeout / 1000;
+        tms.tv_usec = (timeout % 1000) * 1000;
+        ptm = &tms;
+    } else ptm = NULL;
+
+    if (!nconn) {
+        tmp = 0;
+        if (others || !neof) {
+            vosSemWait(sem);
+            tmp = select( (maxsd + 1), rfd, wfd, xfd, ptm );
+            vosSemSignal(sem);
+        }
+    } else {
+        //poll the chip in slices, waking early when a connect completes
+        fd_set crfd, cwfd, cxfd, cwres, cxres;
+        cc3000Deadline dl;
+        cc3000Waiter *w;
+        uint32_t rem;
+        int ready;
+
+        crfd = *rfd;
+        cwfd = *wfd;
+        cxfd = *xfd;
+        cc3000DeadlineStart(&dl, ptm ? (uint32_t)timeout : CC3000_WAIT_FOREVER);
+        w = cc3000WaiterGet(CC3000_EV_SOCK_CONNECT);
+        while (1) {
+            FD_ZERO(&cwres);
+            FD_ZERO(&cxres);
+            ready = cc3000_select_connects(&cfd, maxsd, &cwres, &cxres);
+            tmp = 0;
+            if (others) {
+                *rfd = crfd;
+                *wfd = cwfd;
+                *xfd = cxfd;
+                rem = ready ? 0 : cc3000DeadlineRemaining(&dl);
+                rem = (rem < CC3000_SELECT_POLL_TIME) ? rem : CC3000_SELECT_POLL_TIME;
+                tms.tv_sec = 0;
+                tms.tv_usec = rem * 1000;
+                vosSemWait(sem);
+                tmp = select( (maxsd + 1), rfd, wfd, xfd, &tms );
+                vosSemSignal(sem);
+                if (tmp < 0)
+                    break;
+            }
+            if (tmp > 0 || ready || cc3000DeadlineExpired(&dl))
+                break;
+            if (!others && (cc3000WaiterWait(w, &dl) & CC3000_EV_CANCEL))
+                break;
+        }
+        cc3000WaiterPut(w);
+        if (!others) {
+            FD_ZERO(rfd);
+            FD_ZERO(wfd);
+            FD_ZERO(xfd);
+        }
+        for (i = 0; i < sizeof(fd_set) / sizeof(__fd_mask); i++) {
+            __FDS_BITS(wfd)[i] |= __FDS_BITS(&cwres)[i];
+            __FDS_BITS(xfd)[i] |= __FDS_BITS(&cxres)[i];
+        }
+    }
+    if (tmp < 0)
+        return tmp;
+
+    //merge the eof sockets and count, one pass over the set words
+    tmp = 0;
+    for (i = 0; i < sizeof(fd_set) / sizeof(__fd_mask); i++) {
+        __FDS_BITS(rfd)[i] |= __FDS_BITS(&efd)[i];
+        for (m = __FDS_BITS(rfd)[i] | __FDS_BITS(wfd)[i] | __FDS_BITS(xfd)[i]; m; m &= m - 1)
+            tmp++;
+    }
+    return tmp;
+}
+
+C_NATIVE(cc3000_select) {
+    C_NATIVE_UNWARN();
+    int32_t timeout = -1;
+    int32_t tmp, i, j, sock = -1;
+
+    if (nargs < 4)
+        return ERR_TYPE_EXC;
+
+    fd_set rfd;
+    fd_set wfd;
+    fd_set xfd;
+    PObject *rlist = args[0];
+    PObject *wlist = args[1];
+    PObject *xlist = args[2];
+    fd_set *fdsets[3] = {&rfd, &wfd, &xfd};
+    PObject *slist[3] = {rlist, wlist, xlist};
+    PObject *tm = args[3];
+
+
+    if (tm != MAKE_NONE()) {
+        if (!IS_PSMALLINT(tm))
+            return ERR_TYPE_EXC;
+        timeout = PSMALLINT_VALUE(tm);
+        if (timeout < 0)
+            return ERR_TYPE_EXC;
+    }
+
+    for (j = 0; j < 3; j++) {
+        tmp = PTYPE(slist[j]);
+        if (!IS_OBJ_PSEQUENCE_TYPE(tmp))
+            return ERR_TYPE_EXC;
+        FD_ZERO (fdsets[j]);
+        for (i = 0; i < PSEQUENCE_ELEMENTS(slist[j]); i++) {
+            PObject *fd = PSEQUENCE_OBJECTS(slist[j])[i];
+            if (!IS_PSMALLINT(fd))
+                return ERR_TYPE_EXC;
+            if (PSMALLINT_VALUE(fd) < 0 || PSMALLINT_VALUE(fd) >= __FD_SETSIZE)
+                return ERR_VALUE_EXC;
+            if (cc3000_socket_stale(PSMALLINT_VALUE(fd)))
+                return ERR_IOERROR_EXC;
+            FD_SET(PSMALLINT_VALUE(fd), fdsets[j]);
+            if (PSMALLINT_VALUE(fd) > sock)
+                sock = PSMALLINT_VALUE(fd);
+        }
+    }
+
+    RELEASE_GIL();
+    tmp = cc3000_net_select(sock, &rfd, &wfd, &xfd, timeout);
+    ACQUIRE_GIL();
+
+    if (tmp < 0)
+        return ERR_IOERROR_EXC;
+
+    PTuple *tpl = (PTuple *) psequence_new(PTUPLE, 3);
+    for (j = 0; j < 3; j++) {
+        tmp = 0;
+        for (i = 0; i <= sock; i++) {
+            if (FD_ISSET(i, fdsets[j])) tmp++;
+        }
+        PTuple *rtpl = psequence_new(PTUPLE, tmp);
+        tmp = 0;
+        for (i = 0; i <= sock; i++) {
+            if (FD_ISSET(i, fdsets[j])) {
+                PTUPLE_SET_ITEM(rtpl, tmp, PSMALLINT_NEW(i));
+                tmp++;
+            }
+        }
+        PTUPLE_SET_ITEM(tpl, j, rtpl);
+    }
+    *res = tpl;
+    return ERR_OK;
+}
+
+/* select() on bitmasks: bit n of a mask stands for socket n. The ready masks
+   are written to the caller's bytearray, one byte per set since the chip has
+   CC3000_MAX_SD sockets, so nothing is allocated on the VM heap. */
+C_NATIVE(cc3000_select_into) {
+    C_NATIVE_UNWARN();
+    int32_t rmask, wmask, xmask;
+    int32_t timeout;
+    PObject *out;
+    int32_t tmp;
+    fd_set rfd, wfd, xfd;
+
+    if (nargs != 5 || parse_py_args("iiii", 4, args, &rmask, &wmask, &xmask, &timeout) != 4)
+        return ERR_TYPE_EXC;
+    //the masks are written in place: bytes would be a constant mutated
+    out = args[4];
+    if (PTYPE(out) != PBYTEARRAY)
+        return ERR_TYPE_EXC;
+    if (PSEQUENCE_ELEMENTS(out) < 3)
+        return ERR_VALUE_EXC;
+    if ((rmask | wmask | xmask) & ~((1 << CC3000_MAX_SD) - 1))
+        return ERR_VALUE_EXC;
+    if ((rmask | wmask | xmask) & stale_sds)
+        return ERR_IOERROR_EXC;
+
+    FD_ZERO(&rfd);
+    FD_ZERO(&wfd);
+    FD_ZERO(&xfd);
+    __FDS_BITS(&rfd)[0] = rmask;
+    __FDS_BITS(&wfd)[0] = wmask;
+    __FDS_BITS(&xfd)[0] = xmask;
+
+    RELEASE_GIL();
+    tmp = cc3000_net_select(CC3000_MAX_SD - 1, &rfd, &wfd, &xfd, timeout);
+    ACQUIRE_GIL();
+
+    if (tmp < 0)
+        return ERR_IOERROR_EXC;
+    PSEQUENCE_BYTES(out)[0] = __FDS_BITS(&rfd)[0];
+    PSEQUENCE_BYTES(out)[1] = __FDS_BITS(&wfd)[0];
+    PSEQUENCE_BYTES(out)[2] = __FDS_BITS(&xfd)[0];
+    *res = PSMALLINT_NEW(tmp);
+    return ERR_OK;
+}
+
+
+C_NATIVE(cc3000_socket) {
+    C_NATIVE_UNWARN();
+    int32_t family;
+    int32_t type;
+    int32_t proto;
+    if (parse_py_args("III", nargs, args, DRV_AF_INET, &family, DRV_SOCK_STREAM, &type, IPPROTO_TCP, &proto) != 3)
+        return ERR_TYPE_EXC;
+    if (type != DRV_SOCK_DGRAM && type != DRV_SOCK_STREAM)
+        return ERR_TYPE_EXC;
+    if (family != DRV_AF_INET)
+        return ERR_UNSUPPORTED_EXC;
+    printf("cc3000_socket %i %i %i %i %i %i\n", family, type, proto, args[0], args[1], args[2]);
+    RELEASE_GIL();
+    int32_t sock = cc3000_net_socket((type == DRV_SOCK_DGRAM) ? SOCK_DGRAM : SOCK_STREAM,
+                                     (type == DRV_SOCK_DGRAM) ? IPPROTO_UDP : IPPROTO_TCP);
+    ACQUIRE_GIL();
+    printf("CMD_SOCKET: %i\r\n", sock);
+    if (sock < 0)
+        return ERR_IOERROR_EXC;
+    cc3000_socket_open(sock, type);
+    *res = PSMALLINT_NEW(sock);
+    return ERR_OK;
+}
+
+
+C_NATIVE(cc3000_bind) {
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    NetAddress addr;
+    if (parse_py_args("in", nargs, args, &sock, &addr) != 2)
+        return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock))
+        return ERR_IOERROR_EXC;
+    sockaddr serverSocketAddr;
+    printf("binding_to: %i.%i.%i.%i:%i\r\n", OAL_IP_AT(addr.ip, 0), OAL_IP_AT(addr.ip, 1), OAL_IP_AT(addr.ip, 2),
+           OAL_IP_AT(addr.ip, 3), OAL_GET_NETPORT(addr.port));
+    addr.ip = 0;
+    cc3000_prepare_addr(&serverSocketAddr, &addr);
+    printf("binding to: %i.%i.%i.%i: %i-%i\r\n", serverSocketAddr.sa_data[2], serverSocketAddr.sa_data[3],
+           serverSocketAddr.sa_data[4], serverSocketAddr.sa_data[5], serverSocketAddr.sa_data[0], serverSocketAddr.sa_data[1]);
+    RELEASE_GIL();
+    vosSemWait(sem);
+    sock = bind(sock, &serverSocketAddr, sizeof(sockaddr));
+    vosSemSignal(sem);
+    ACQUIRE_GIL();
+    printf("binding: %i\r\n", sock);
+    if (sock < 0)
+        return ERR_IOERROR_EXC;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+
+C_NATIVE(cc3000_sockopt) {
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    int32_t level;
+    int32_t optname;
+    int32_t optvalue;
+    int32_t tmp;
+
+    if (parse_py_args("iiii", nargs, args, &sock, &level, &optname, &optvalue) != 4)
+        return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock))
+        return ERR_IOERROR_EXC;
+
+    vosSemWait(sem);
+    tmp = setsockopt(sock, level, optname, &optvalue, sizeof(optvalue));
+    vosSemSignal(sem);
+    if (tmp < 0)
+        return ERR_IOERROR_EXC;
+    if (level == SOL_SOCKET && optname == SOCKOPT_RECV_TIMEOUT && cc3000_socket_get(sock))
+        cc3000_socket_get(sock)->rcvtimeo = optvalue;
+
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_listen) {
+    C_NATIVE_UNWARN();
+    int32_t maxlog;
+    int32_t sock;
+    if (parse_py_args("ii", nargs, args, &sock, &maxlog) != 2)
+        return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock))
+        return ERR_IOERROR_EXC;
+    RELEASE_GIL();
+    vosSemWait(sem);
+    maxlog = listen(sock, maxlog);
+    vosSemSignal(sem);
+    ACQUIRE_GIL();
+    if (maxlog)
+        return ERR_IOERROR_EXC;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+
+C_NATIVE(cc3000_accept) {
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    NetAddress addr;
+    if (parse_py_args("i", nargs, args, &sock) != 1)
+        return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock))
+        return ERR_IOERROR_EXC;
+    sockaddr clientaddr;
+    socklen_t addrlen;
+    memset(&clientaddr, 0, sizeof(sockaddr));
+    addrlen = sizeof(sockaddr);
+    RELEASE_GIL();
+    vosSemWait(sem);
+    char arg = SOCK_ON;
+    if (setsockopt(sock, SOL_SOCKET, SOCKOPT_ACCEPT_NONBLOCK, &arg, sizeof(arg)) < 0) {
+        printf("CMD_ACCEPT: no sockopt");
+        sock = -1;
+    }
+    vosSemSignal(sem);
+    if (sock >= 0) {
+        int32_t ecd = SOC_IN_PROGRESS;
+        int cancelled = 0;
+        cc3000Deadline dl;
+        cc3000Waiter *w = cc3000WaiterGet(CC3000_EV_CANCEL);
+        //any negative answer, SOC_ERROR included, is retried: only cancel() ends the wait
+        while (ecd <= -1 && !cancelled) {
+            vosSemWait(sem);
+            ecd = accept(sock, &clientaddr, &addrlen);
+            vosSemSignal(sem);
+            if (ecd <= -1) {
+                cc3000DeadlineStart(&dl, CC3000_ACCEPT_POLL_TIME);
+                while (!cancelled && !cc3000DeadlineExpired(&dl))
+                    cancelled = (cc3000WaiterWait(w, &dl) & CC3000_EV_CANCEL) != 0;
+            }
+            printf("CMD_ACCEPT: accept state %i\r\n", ecd);
+        }
+        cc3000WaiterPut(w);
+        sock = ecd;
+        cc3000_socket_open(sock, DRV_SOCK_STREAM);
+    }
+    ACQUIRE_GIL();
+    if (sock < 0)
+        return ERR_IOERROR_EXC;
+
+    memcpy(&addr.ip, clientaddr.sa_data + 2, 4);
+    memcpy(&addr.port, clientaddr.sa_data, 2);
+    addr.ip = BLTSWAP32(addr.ip);
+    printf("CMD_ACCEPT: %i\r\n", sock);
+    PTuple *tpl = (PTuple *) psequence_new(PTUPLE, 2);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(sock));
+    PObject *ipo = netaddress_to_object(&addr);
+    PTUPLE_SET_ITEM(tpl, 1, ipo);
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_connect) {
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    NetAddress addr;
+    int ret;
+
+    if (parse_py_args("in", nargs, args, &sock, &addr) != 2)
+        return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock))
+        return ERR_IOERROR_EXC;
+    printf("connecting_to: %i.%i.%i.%i:%i\r\n", OAL_IP_AT(addr.ip, 0), OAL_IP_AT(addr.ip, 1), OAL_IP_AT(addr.ip, 2),
+           OAL_IP_AT(addr.ip, 3), OAL_GET_NETPORT(addr.port));
+    RELEASE_GIL();
+    //issued through the tracker, so that the handshake does not hold the driver semaphore
+    if (cc3000_connect_submit(sock, &addr) < 0) {
+        ACQUIRE_GIL();
+        return ERR_IOERROR_EXC;
+    }
+    ret = cc3000_connect_wait(sock, CC3000_CONNECT_TIMEOUT);
+    if (ret == CC3000_CONN_PENDING) {
+        //an answer lost or still owed: the late one is matched to the abandoned slot
+        cc3000_net_close(sock);
+    } else {
+        cc3000ConnRelease(sock);
+    }
+    ACQUIRE_GIL();
+    printf("CMD_OPEN: %i %i\r\n", sock, ret);
+    if (ret == CC3000_CONN_PENDING)
+        return ERR_TIMEOUT_EXC;
+    if (ret != CC3000_CONN_DONE) {
+        return ERR_IOERROR_EXC;
+    }
+    *res = PSMALLINT_NEW(0);
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_connect_start) {
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    NetAddress addr;
+    int ret;
+
+    if (parse_py_args("in", nargs, args, &sock, &addr) != 2)
+        return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock))
+        return ERR_IOERROR_EXC;
+    RELEASE_GIL();
+    ret = cc3000_connect_submit(sock, &addr);
+    ACQUIRE_GIL();
+    if (ret < 0)
+        return ERR_IOERROR_EXC;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_connect_poll) {
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    int32_t timeout;
+    int ret;
+
+    if (parse_py_args("iI", nargs, args, &sock, 0, &timeout) != 2)
+        return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock))
+        return ERR_IOERROR_EXC;
+    if (timeout < 0)
+        return ERR_TYPE_EXC;
+    RELEASE_GIL();
+    ret = cc3000_connect_wait(sock, timeout);
+    if (ret != CC3000_CONN_PENDING)
+        cc3000ConnRelease(sock);
+    ACQUIRE_GIL();
+    if (ret == CC3000_CONN_PENDING) {
+        *res = MAKE_NONE();
+        return ERR_OK;
+    }
+    if (ret == CC3000_CONN_NONE)
+        return ERR_VALUE_EXC;
+    if (ret != CC3000_CONN_DONE)
+        return ERR_IOERROR_EXC;
+    *res = PSMALLINT_NEW(0);
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_close) {
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    if (parse_py_args("i", nargs, args, &sock) != 1)
+        return ERR_TYPE_EXC;
+    RELEASE_GIL();
+    if (cc3000_socket_stale(sock))
+        cc3000_socket_forget(sock);
+    else
+        cc3000_net_close(sock);
+    ACQUIRE_GIL();
+    *res = PSMALLINT_NEW(sock);
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_pool_connect) {
+    C_NATIVE_UNWARN();
+    NetAddress addr;
+    int32_t dead[CC3000_MAX_SD];
+    int32_t sd, sock = -1, oldest = -1;
+    int i, ndead, nfree = 0;
+
+    if (parse_py_args("n", nargs, args, &addr) != 1)
+        return ERR_TYPE_EXC;
+
+    ndead = cc3000_pool_expire(dead);
+    for (sd = 0; sd < CC3000_MAX_SD; sd++) {
+        if (socks[sd].pool == POOL_PARKED && socks[sd].peer.ip == addr.ip && socks[sd].peer.port == addr.port) {
+            socks[sd].pool = POOL_LEASED;
+            sock = sd;
+            break;
+        }
+    }
+    if (sock < 0) {
+        //every descriptor in use: make room by closing the least recently parked socket
+        for (sd = 0; sd < CC3000_MAX_SD; sd++) {
+            if (!socks[sd].valid)
+                nfree++;
+            else if (socks[sd].pool == POOL_PARKED && (oldest < 0 || (int32_t)(socks[sd].idle_since - socks[oldest].idle_since) < 0))
+                oldest = sd;
+        }
+        if (!nfree && oldest >= 0) {
+            socks[oldest].pool = POOL_FREE;
+            dead[ndead++] = oldest;
+        }
+    }
+
+    RELEASE_GIL();
+    for (i = 0; i < ndead; i++)
+        cc3000_net_close(dead[i]);
+    if (sock >= 0 && cc3000ConnState(sock) != CC3000_CONN_NONE) {
+        //opened again by power_wake(): collect its connect
+        if (cc3000_connect_wait(sock, CC3000_CONNECT_TIMEOUT) != CC3000_CONN_DONE) {
+            cc3000_net_close(sock);
+            sock = -1;
+        } else {
+            cc3000ConnRelease(sock);
+        }
+    } else if (sock >= 0 && cc3000_net_available(sock, 0) != 0) {
+        //a parked socket with something to read has been closed or confused by the peer
+        cc3000_net_close(sock);
+        sock = -1;
+    }
+    if (sock < 0) {
+        sock = cc3000_net_socket(SOCK_STREAM, IPPROTO_TCP);
+        if (sock >= 0) {
+            cc3000_socket_open(sock, DRV_SOCK_STREAM);
+            if (cc3000_connect_submit(sock, &addr) < 0 || cc3000_connect_wait(sock, CC3000_CONNECT_TIMEOUT) != CC3000_CONN_DONE) {
+                cc3000_net_close(sock);
+                sock = -1;
+            } else {
+                cc3000ConnRelease(sock);
+            }
+        }
+    }
+    ACQUIRE_GIL();
+
+    if (sock < 0)
+        return ERR_IOERROR_EXC;
+    socks[sock].pool = POOL_LEASED;
+    socks[sock].peer = addr;
+    *res = PSMALLINT_NEW(sock);
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_pool_release) {
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    cc3000Socket *s;
+
+    if (parse_py_args("i", nargs, args, &sock) != 1)
+        return ERR_TYPE_EXC;
+    if (cc3000_socket_stale(sock)) {
+        RELEASE_GIL();
+        cc3000_socket_forget(sock);
+        ACQUIRE_GIL();
+        *res = MAKE_NONE();
+        return ERR_OK;
+    }
+    s = cc3000_socket_get(sock);
+    if (s && s->pool == POOL_LEASED && pool_max_idle && cc3000_pool_alive(sock)) {
+        s->pool = POOL_PARKED;
+        s->idle_since = vosMillis();
+    } else {
+        if (s)
+            s->pool = POOL_FREE;
+        RELEASE_GIL();
+        cc3000_net_close(sock);
+        ACQUIRE_GIL();
+    }
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_pool_config) {
+    C_NATIVE_UNWARN();
+    int32_t max_idle;
+    if (parse_py_args("I", nargs, args, CC3000_POOL_IDLE_TIMEOUT, &max_idle) != 1)
+        return ERR_TYPE_EXC;
+    if (max_idle < 0)
+        return ERR_TYPE_EXC;
+    pool_max_idle = max_idle;
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_pool_flush) {
+    C_NATIVE_UNWARN();
+    int32_t dead[CC3000_MAX_SD];
+    int32_t sd;
+    int i, ndead = 0;
+
+    for (sd = 0; sd < CC3000_MAX_SD; sd++) {
+        if (socks[sd].pool == POOL_PARKED) {
+            dead[ndead++] = sd;
+            socks[sd].pool = POOL_FREE;
+        }
+    }
+    RELEASE_GIL();
+    for (i = 0; i < ndead; i++)
+        cc3000_net_close(dead[i]);
+    ACQUIRE_GIL();
+    *res = PSMALLINT_NEW(ndead);
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_socket_stats) {
+    C_NATIVE_UNWARN();
+    int32_t sock;
+    cc3000Socket *s;
+
+    if (parse_py_args("i", nargs, args, &sock) != 1)
+        return ERR_TYPE_EXC;
+    s = cc3000_socket_get(sock);
+    if (!s || !s->valid)
+        return ERR_VALUE_EXC;
+    PTuple *tpl = psequence_new(PTUPLE, 4);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(s->rx_bytes));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(s->tx_bytes));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(s->rcvtimeo));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(s->eof));
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_resolve) {
+    C_NATIVE_UNWARN();
+    uint8_t *url;
+    uint32_t len;
+    NetAddress addr;
+    int q, ret;
+    if (parse_py_args("s", nargs, args, &url, &len) != 1)
+        return ERR_TYPE_EXC;
+    addr.ip = 0;
+    addr.port = 0;
+    RELEASE_GIL();
+    cc3000_resolver_warmup();
+    q = cc3000_resolve_submit(url, len, 0);
+    ret = (q < 0) ? CC3000_DNS_INVALID : cc3000_resolve_wait(q, url, len, CC3000_DNS_RESOLVE_TIMEOUT, &addr.ip);
+    if (ret == CC3000_DNS_PENDING)
+        cc3000DnsQueryAbandon(q);
+    ACQUIRE_GIL();
+    if (ret != CC3000_DNS_HIT)
+        return ERR_IOERROR_EXC;
+    *res = netaddress_to_object(&addr);
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_resolve_start) {
+    C_NATIVE_UNWARN();
+    uint8_t *url;
+    uint32_t len;
+    int q;
+    if (parse_py_args("s", nargs, args, &url, &len) != 1)
+        return ERR_TYPE_EXC;
+    RELEASE_GIL();
+    cc3000_resolver_warmup();
+    q = cc3000_resolve_submit(url, len, 0);
+    ACQUIRE_GIL();
+    if (q < 0)
+        return ERR_IOERROR_EXC;
+    *res = PSMALLINT_NEW(q);
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_resolve_poll) {
+    C_NATIVE_UNWARN();
+    int32_t q;
+    int32_t timeout;
+    NetAddress addr;
+    int ret;
+    if (parse_py_args("iI", nargs, args, &q, 0, &timeout) != 2)
+        return ERR_TYPE_EXC;
+    if (timeout < 0)
+        return ERR_TYPE_EXC;
+    addr.ip = 0;
+    addr.port = 0;
+    RELEASE_GIL();
+    ret = cc3000_resolve_wait(q, NULL, 0, timeout, &addr.ip);
+    ACQUIRE_GIL();
+    if (ret == CC3000_DNS_PENDING) {
+        *res = MAKE_NONE();
+        return ERR_OK;
+    }
+    if (ret == CC3000_DNS_INVALID)
+        return ERR_VALUE_EXC;
+    if (ret != CC3000_DNS_HIT)
+        return ERR_IOERROR_EXC;
+    *res = netaddress_to_object(&addr);
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_resolve_cancel) {
+    C_NATIVE_UNWARN();
+    int32_t q;
+    if (parse_py_args("i", nargs, args, &q) != 1)
+        return ERR_TYPE_EXC;
+    cc3000DnsQueryAbandon(q);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_dns_config) {
+    C_NATIVE_UNWARN();
+    int32_t ttl;
+    int32_t neg_ttl;
+    if (parse_py_args("iI", nargs, args, &ttl, CC3000_DNS_DEFAULT_NEG_TTL, &neg_ttl) != 2)
+        return ERR_TYPE_EXC;
+    if (ttl < 0 || neg_ttl < 0)
+        return ERR_TYPE_EXC;
+    cc3000DnsConfig(ttl, neg_ttl);
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_dns_flush) {
+    C_NATIVE_UNWARN();
+    cc3000DnsFlush();
+    *res = MAKE_NONE();
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_dns_stats) {
+    C_NATIVE_UNWARN();
+    PTuple *tpl = psequence_new(PTUPLE, 5);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(cc3000DnsCounters.hits));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(cc3000DnsCounters.negative_hits));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(cc3000DnsCounters.misses));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(cc3000DnsCounters.evictions));
+    PTUPLE_SET_ITEM(tpl, 4, PSMALLINT_NEW(cc3000DnsCounters.resolve_ms));
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_boot_timeline) {
+    C_NATIVE_UNWARN();
+    int i;
+    PTuple *tpl = psequence_new(PTUPLE, CC3000_BOOT_STEPS);
+    for (i = 0; i < CC3000_BOOT_STEPS; i++) {
+        if (cc3000BootTimeline[i] == CC3000_BOOT_UNREACHED)
+            PTUPLE_SET_ITEM(tpl, i, PSMALLINT_NEW(-1));
+        else
+            PTUPLE_SET_ITEM(tpl, i, PSMALLINT_NEW(cc3000BootTimeline[i]));
+    }
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_event_mask) {
+    C_NATIVE_UNWARN();
+    int32_t mask;
+    int32_t ret;
+    uint32_t old = event_mask;
+
+    if (parse_py_args("i", nargs, args, &mask) != 1)
+        return ERR_TYPE_EXC;
+    //masks use the HCI_EVNT_WLAN_* bits, without the unsolicited base
+    mask |= HCI_EVNT_WLAN_UNSOL_BASE;
+    if (mask & ~CC3000_EVENT_MASK_OPTIONAL)
+        return ERR_VALUE_EXC;
+
+    RELEASE_GIL();
+    vosSemWait(sem);
+    ret = wlan_set_event_mask(mask);
+    if (ret == 0)
+        event_mask = mask;
+    vosSemSignal(sem);
+    ACQUIRE_GIL();
+    if (ret != 0)
+        return ERR_IOERROR_EXC;
+    *res = PSMALLINT_NEW(old & ~HCI_EVNT_WLAN_UNSOL_BASE);
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_event_stats) {
+    C_NATIVE_UNWARN();
+    PTuple *tpl = psequence_new(PTUPLE, 7);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(cc3000EventCounters.events));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(cc3000EventCounters.keepalive));
+    PTUPLE_SET_ITEM(tpl, 2, PSMALLINT_NEW(cc3000EventCounters.tx_complete));
+    PTUPLE_SET_ITEM(tpl, 3, PSMALLINT_NEW(cc3000SpiCounters.rx_packets));
+    PTUPLE_SET_ITEM(tpl, 4, PSMALLINT_NEW(cc3000SpiCounters.rx_bytes));
+    PTUPLE_SET_ITEM(tpl, 5, PSMALLINT_NEW(cc3000SpiCounters.wakes));
+    PTUPLE_SET_ITEM(tpl, 6, PSMALLINT_NEW(cc3000SpiCounters.max_burst));
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_set_info) {
+    C_NATIVE_UNWARN();
+
+    NetAddress ip;
+    NetAddress mask;
+    NetAddress gw;
+    NetAddress dns;
+
+    if (parse_py_args("nnnn", nargs, args,
+                      &ip,
+                      &mask,
+                      &gw,
+                      &dns) != 4) return ERR_TYPE_EXC;
+
+    if (dns.ip == 0) {
+        OAL_MAKE_IP(dns.ip, 8, 8, 8, 8);
+    }
+    if (mask.ip == 0) {
+        OAL_MAKE_IP(mask.ip, 255, 255, 255, 255);
+    }
+    if (gw.ip == 0) {
+        OAL_MAKE_IP(gw.ip, OAL_IP_AT(ip.ip, 0), OAL_IP_AT(ip.ip, 1), OAL_IP_AT(ip.ip, 2), 1);
+    }
+
+    net_ip.ip = ip.ip;
+    net_gw.ip = gw.ip;
+    net_dns.ip = dns.ip;
+    net_mask.ip = mask.ip;
+    if (ip.ip != 0)
+        net_info_set = 1;
+    else
+        net_info_set = 0;
+
+    *res = MAKE_NONE();
+    return ERR_OK;
+
+}
+
+/** @brief Copies #info_cache to @p out, rebuilding it first when the link
+ *         changed since it was built.
+ *  @details The address comes from the last DHCP event when there is one,
+ *           so the chip is asked only for the MAC, once, and when not
+ *           associated. The record is built in @p out and published whole
+ *           under the global semaphore, so concurrent calls see the old
+ *           record or the new one. Called with the GIL released. */
+static void cc3000_info_refresh(cc3000Info *out) {
+    tNetappIpconfigRetArgs ipConfig;
+    uint32_t epoch = cc3000LinkEpoch();
+    uint32_t now = vosMillis();
+
+    vosSemWait(sem);
+    if (info_cache.valid && info_cache.epoch == epoch && (now - info_cache.stored) < CC3000_INFO_MAX_AGE) {
+        info_cache.hits++;
+        *out = info_cache;
+        vosSemSignal(sem);
+        return;
+    }
+    *out = info_cache;
+    if (out->mac_valid && cc3000AsyncData.dhcp.present) {
+        memcpy(out->ip, (void *)cc3000AsyncData.dhcp.info.aucIP, 4);
+        memcpy(out->mask, (void *)cc3000AsyncData.dhcp.info.aucSubnetMask, 4);
+        memcpy(out->gw, (void *)cc3000AsyncData.dhcp.info.aucDefaultGateway, 4);
+        memcpy(out->dns, (void *)cc3000AsyncData.dhcp.info.aucDNSServer, 4);
+    } else {
+        netapp_ipconfig(&ipConfig);
+        memcpy(out->ip, ipConfig.aucIP, 4);
+        memcpy(out->mask, ipConfig.aucSubnetMask, 4);
+        memcpy(out->gw, ipConfig.aucDefaultGateway, 4);
+        memcpy(out->dns, ipConfig.aucDNSServer, 4);
+        memcpy(out->mac, ipConfig.uaMacAddr, 6);
+        out->mac_valid = 1;
+        out->refreshes++;
+    }
+    //an event during the copy changes the epoch: the next call rebuilds
+    out->epoch = epoch;
+    out->stored = now;
+    out->valid = 1;
+    info_cache = *out;
+    vosSemSignal(sem);
+}
+
+static PObject *cc3000_info_addr(uint8_t *tb) {
+    NetAddress addr;
+    addr.port = 0;
+    memcpy(&addr.ip, tb, 4);
+    addr.ip = BLTSWAP32(addr.ip);
+    return netaddress_to_object(&addr);
+}
+
+C_NATIVE(cc3000_info) {
+    C_NATIVE_UNWARN();
+    PTuple *tpl;
+    PObject *mac;
+    cc3000Info info;
+
+    RELEASE_GIL();
+    cc3000_info_refresh(&info);
+    ACQUIRE_GIL();
+
+    tpl = psequence_new(PTUPLE, 5);
+    PTUPLE_SET_ITEM(tpl, 0, cc3000_info_addr(info.ip));
+    PTUPLE_SET_ITEM(tpl, 1, cc3000_info_addr(info.mask));
+    PTUPLE_SET_ITEM(tpl, 2, cc3000_info_addr(info.gw));
+    PTUPLE_SET_ITEM(tpl, 3, cc3000_info_addr(info.dns));
+    mac = psequence_new(PBYTES, 6);
+    memcpy(PSEQUENCE_BYTES(mac), info.mac, 6);
+    PTUPLE_SET_ITEM(tpl, 4, mac);
+    *res = tpl;
+    return ERR_OK;
+}
+
+C_NATIVE(cc3000_info_stats) {
+    C_NATIVE_UNWARN();
+    PTuple *tpl = psequence_new(PTUPLE, 2);
+    PTUPLE_SET_ITEM(tpl, 0, PSMALLINT_NEW(info_cache.hits));
+    PTUPLE_SET_ITEM(tpl, 1, PSMALLINT_NEW(info_cache.refreshes));
+    *res = tpl;
+    return ERR_OK;
 }
\ No newline at end of file
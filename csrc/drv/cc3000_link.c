@@ -0,0 +1,83 @@
+/** @file
+ *  @brief Link state machine driven by the unsolicited wlan events.
+ *  @details The host moves the link to associating when it issues a join
+ *           and back to idle when it leaves; every other transition is
+ *           made by CC3000AsyncCb(), which also fires the matching driver
+ *           event, so a transition can be waited for with a #cc3000Waiter. */
+
+#include "cc3000_link.h"
+
+static cc3000LinkInfo link;
+static VSemaphore link_lock = NULL;
+
+static void link_enter(uint8_t state) {
+    link.state = state;
+    link.entered[state] = vosMillis();
+    link.epoch++;
+    if (state == CC3000_LINK_LOST)
+        link.losses++;
+}
+
+void cc3000LinkInit(void) {
+    if (!link_lock)
+        link_lock = vosSemCreate(1);
+    memset(&link, 0, sizeof(link));
+    link_enter(CC3000_LINK_IDLE);
+}
+
+/** @brief The host issued a join. */
+void cc3000LinkJoin(void) {
+    vosSemWait(link_lock);
+    link_enter(CC3000_LINK_ASSOCIATING);
+    vosSemSignal(link_lock);
+}
+
+/** @brief The host disconnected or stopped the chip. */
+void cc3000LinkLeave(void) {
+    vosSemWait(link_lock);
+    link_enter(CC3000_LINK_IDLE);
+    vosSemSignal(link_lock);
+}
+
+/** @brief HCI_EVNT_WLAN_UNSOL_CONNECT, also for joins the chip starts by itself. */
+void cc3000LinkConnected(void) {
+    vosSemWait(link_lock);
+    if (link.state != CC3000_LINK_ASSOCIATED && link.state != CC3000_LINK_IP_READY)
+        link_enter(CC3000_LINK_ASSOCIATED);
+    vosSemSignal(link_lock);
+}
+
+/** @brief HCI_EVNT_WLAN_UNSOL_DISCONNECT. Ignored when idle, as it answers a
+ *         disconnect asked by the host. */
+void cc3000LinkDisconnected(void) {
+    vosSemWait(link_lock);
+    if (link.state != CC3000_LINK_IDLE)
+        link_enter(CC3000_LINK_LOST);
+    vosSemSignal(link_lock);
+}
+
+/** @brief HCI_EVNT_WLAN_UNSOL_DHCP, @p ok when it carries an address. */
+void cc3000LinkDhcp(int ok) {
+    vosSemWait(link_lock);
+    if (ok && link.state == CC3000_LINK_ASSOCIATED)
+        link_enter(CC3000_LINK_IP_READY);
+    else
+        link.epoch++;   //a renewal may change the address
+    vosSemSignal(link_lock);
+}
+
+/** @brief Current epoch, see #cc3000LinkInfo. */
+uint32_t cc3000LinkEpoch(void) {
+    return link.epoch;
+}
+
+int cc3000LinkState(void) {
+    return link.state;
+}
+
+/** @brief Copies the state and its timestamps to @p info. */
+void cc3000LinkGet(cc3000LinkInfo *info) {
+    vosSemWait(link_lock);
+    memcpy(info, &link, sizeof(link));
+    vosSemSignal(link_lock);
+}
@@ -0,0 +1,35 @@
+/** @file
+ *  @brief Link state machine driven by the unsolicited wlan events. */
+
+#ifndef __CC3000_LINK__
+#define __CC3000_LINK__
+
+#include "viper.h"
+
+/** @brief State of the link, as returned by cc3000LinkState(). */
+#define CC3000_LINK_IDLE            (0)     ///< Not associated, no join in progress.
+#define CC3000_LINK_ASSOCIATING     (1)     ///< Join issued, waiting for HCI_EVNT_WLAN_UNSOL_CONNECT.
+#define CC3000_LINK_ASSOCIATED      (2)     ///< Associated, waiting for HCI_EVNT_WLAN_UNSOL_DHCP.
+#define CC3000_LINK_IP_READY        (3)     ///< Associated with a valid address.
+#define CC3000_LINK_LOST            (4)     ///< Disconnected by the access point, or join refused.
+#define CC3000_LINK_STATES          (5)
+
+/** @brief Link state and the time each state was last entered. */
+typedef struct {
+    uint8_t state;                          ///< One of CC3000_LINK_*.
+    uint32_t entered[CC3000_LINK_STATES];   ///< vosMillis() at the last entry in each state.
+    uint32_t losses;                        ///< Transitions to #CC3000_LINK_LOST.
+    uint32_t epoch;                         ///< Changes at every transition and DHCP event.
+} cc3000LinkInfo;
+
+void cc3000LinkInit(void);
+void cc3000LinkJoin(void);
+void cc3000LinkLeave(void);
+void cc3000LinkConnected(void);
+void cc3000LinkDisconnected(void);
+void cc3000LinkDhcp(int ok);
+int cc3000LinkState(void);
+uint32_t cc3000LinkEpoch(void);
+void cc3000LinkGet(cc3000LinkInfo *info);
+
+#endif /* __CC3000_LINK__ */
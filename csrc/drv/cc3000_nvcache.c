@@ -0,0 +1,182 @@
+/** @file
+ *  @brief Write-back RAM cache of selected NVMEM files.
+ *  @details nvmem_read() and nvmem_write() ask the cache first, so every
+ *           caller, aes_read_key() included, sees the cached data. A file is
+ *           loaded at the first access and written back, limited to the
+ *           range that changed, by cc3000NvCacheFlush() or when it has been
+ *           idle for #CC3000_NVCACHE_IDLE_TIME. Accesses beyond the cached
+ *           size go to the chip after a write-back, and fail when it fails,
+ *           so that the chip never serves them around dirty data. Like the
+ *           rest of the NVMEM layer, the functions are called with the global
+ *           driver semaphore held. */
+
+#include "cc3000_nvcache.h"
+#include "../nvmem.h"
+
+static cc3000NvCacheSlot nvcache[CC3000_NVCACHE_SLOTS];
+
+uint32_t cc3000NvmemWrites[CC3000_NVCACHE_FILES];
+
+void cc3000NvCacheInit(void) {
+    int i;
+    memset(nvcache, 0, sizeof(nvcache));
+    for (i = 0; i < CC3000_NVCACHE_SLOTS; i++)
+        nvcache[i].fileid = -1;
+}
+
+cc3000NvCacheSlot *cc3000NvCacheGet(int32_t fileid) {
+    int i;
+    for (i = 0; i < CC3000_NVCACHE_SLOTS; i++) {
+        if (nvcache[i].fileid == fileid)
+            return &nvcache[i];
+    }
+    return NULL;
+}
+
+/** @brief Counts an HCI write to @p fileid. Called by the NVMEM layer. */
+void cc3000NvmemCountWrite(uint32_t fileid) {
+    if (fileid < CC3000_NVCACHE_FILES)
+        cc3000NvmemWrites[fileid]++;
+}
+
+static int nvcache_writeback(cc3000NvCacheSlot *s) {
+    int ret;
+    if (!s->dirty)
+        return 0;
+    ret = nvmem_write_uncached(s->fileid, s->hi - s->lo, s->lo, s->data + s->lo);
+    if (ret == 0) {
+        s->dirty = 0;
+        s->flushes++;
+    }
+    return ret;
+}
+
+static int nvcache_load(cc3000NvCacheSlot *s) {
+    if (s->loaded)
+        return 0;
+    if (nvmem_read_uncached(s->fileid, s->size, 0, s->data) != 0)
+        return -1;
+    s->loaded = 1;
+    s->loads++;
+    return 0;
+}
+
+/** @brief Caches the first @p size bytes of @p fileid, or stops caching it
+ *         when @p size is 0, after writing back its dirty data.
+ *  @return 0, or -1 when no slot is free, @p size is too big or the write-back failed. */
+int cc3000NvCacheEnable(uint32_t fileid, uint32_t size) {
+    cc3000NvCacheSlot *s;
+
+    if (size > CC3000_NVCACHE_FILE_SIZE || fileid >= CC3000_NVCACHE_FILES)
+        return -1;
+    s = cc3000NvCacheGet(fileid);
+    if (s) {
+        if (nvcache_writeback(s) != 0)
+            return -1;
+        if (!size) {
+            s->fileid = -1;
+            return 0;
+        }
+    } else {
+        if (!size)
+            return 0;
+        s = cc3000NvCacheGet(-1);
+        if (!s)
+            return -1;
+        memset(s, 0, sizeof(*s));
+        s->fileid = fileid;
+    }
+    s->size = size;
+    s->loaded = 0;
+    return 0;
+}
+
+/** @brief Writes back @p fileid, or every file when it is negative. With
+ *         @p idle, only files untouched for #CC3000_NVCACHE_IDLE_TIME.
+ *  @return The number of files that failed to write back. */
+int cc3000NvCacheFlush(int32_t fileid, uint32_t idle) {
+    int i, failed = 0;
+    uint32_t now = vosMillis();
+
+    for (i = 0; i < CC3000_NVCACHE_SLOTS; i++) {
+        if (nvcache[i].fileid < 0 || !nvcache[i].dirty)
+            continue;
+        if (fileid >= 0 && nvcache[i].fileid != fileid)
+            continue;
+        if (idle && (now - nvcache[i].touched) < CC3000_NVCACHE_IDLE_TIME)
+            continue;
+        if (nvcache_writeback(&nvcache[i]) != 0)
+            failed++;
+    }
+    return failed;
+}
+
+/** @brief Serves a read from the cache.
+ *  @return 0 if served, -1 if the caller must read from the chip,
+ *          #CC3000_NVCACHE_FAILED if the read must fail. */
+int cc3000NvCacheRead(uint32_t fileid, uint32_t len, uint32_t offset, uint8_t *buf) {
+    cc3000NvCacheSlot *s;
+
+    cc3000NvCacheFlush(-1, 1);
+    s = cc3000NvCacheGet(fileid);
+    if (!s)
+        return -1;
+    if (offset + len > s->size) {
+        //the chip must see what is only in RAM
+        if (nvcache_writeback(s) != 0)
+            return CC3000_NVCACHE_FAILED;
+        return -1;
+    }
+    if (nvcache_load(s) != 0)
+        return -1;
+    memcpy(buf, s->data + offset, len);
+    s->hits++;
+    return 0;
+}
+
+/** @brief Takes a write into the cache, to be written back later.
+ *  @return 0 if taken, -1 if the caller must write to the chip,
+ *          #CC3000_NVCACHE_FAILED if the write must fail. */
+int cc3000NvCacheWrite(uint32_t fileid, uint32_t len, uint32_t offset, uint8_t *buf) {
+    cc3000NvCacheSlot *s;
+
+    cc3000NvCacheFlush(-1, 1);
+    s = cc3000NvCacheGet(fileid);
+    if (!s)
+        return -1;
+    if (offset + len > s->size) {
+        //written through: the cached copy would be stale; dirty data that
+        //did not reach the chip is kept, and the write is refused
+        if (nvcache_writeback(s) != 0)
+            return CC3000_NVCACHE_FAILED;
+        s->loaded = 0;
+        return -1;
+    }
+    if (nvcache_load(s) != 0)
+        return -1;
+    if (!len || memcmp(s->data + offset, buf, len) == 0)
+        return 0;
+    memcpy(s->data + offset, buf, len);
+    if (!s->dirty) {
+        s->dirty = 1;
+        s->lo = offset;
+        s->hi = offset + len;
+    } else {
+        if (offset < s->lo)
+            s->lo = offset;
+        if (offset + len > s->hi)
+            s->hi = offset + len;
+    }
+    s->touched = vosMillis();
+    return 0;
+}
+
+/** @brief Forgets the cached copy of @p fileid, dirty data included, as
+ *         nvmem_create_entry() is reallocating it. */
+void cc3000NvCacheDrop(uint32_t fileid) {
+    cc3000NvCacheSlot *s = cc3000NvCacheGet(fileid);
+    if (s) {
+        s->loaded = 0;
+        s->dirty = 0;
+    }
+}
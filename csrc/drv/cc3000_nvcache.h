@@ -0,0 +1,52 @@
+/** @file
+ *  @brief Write-back RAM cache of selected NVMEM files. */
+
+#ifndef __CC3000_NVCACHE__
+#define __CC3000_NVCACHE__
+
+#include "viper.h"
+
+/** @brief Number of files that can be cached at once. */
+#define CC3000_NVCACHE_SLOTS        (2)
+
+/** @brief Largest cached file, in bytes. */
+#define CC3000_NVCACHE_FILE_SIZE    (128)
+
+/** @brief Dirty data untouched for this long is written back at the next cache access, in milliseconds. */
+#define CC3000_NVCACHE_IDLE_TIME    (5000)
+
+/** @brief Returned for an access the chip must not serve: the dirty data
+ *         before it could not be written back. */
+#define CC3000_NVCACHE_FAILED       (-2)
+
+/** @brief Number of NVMEM file ids, see NVMEM_MAX_ENTRY. */
+#define CC3000_NVCACHE_FILES        (16)
+
+/** @brief A cached file. */
+typedef struct {
+    int8_t fileid;                  ///< -1 when the slot is free.
+    uint8_t loaded;                 ///< @p data holds the file.
+    uint8_t dirty;                  ///< @p data differs from NVMEM in [@p lo, @p hi).
+    uint16_t size;                  ///< Bytes cached from offset 0.
+    uint16_t lo;
+    uint16_t hi;
+    uint32_t touched;               ///< vosMillis() at the last write.
+    uint32_t hits;                  ///< Reads served from RAM.
+    uint32_t loads;                 ///< Reads of the file from NVMEM.
+    uint32_t flushes;               ///< Write-backs.
+    uint8_t data[CC3000_NVCACHE_FILE_SIZE];
+} cc3000NvCacheSlot;
+
+/** @brief HCI writes per file id, cached or not. */
+extern uint32_t cc3000NvmemWrites[CC3000_NVCACHE_FILES];
+
+void cc3000NvCacheInit(void);
+int cc3000NvCacheEnable(uint32_t fileid, uint32_t size);
+int cc3000NvCacheFlush(int32_t fileid, uint32_t idle);
+int cc3000NvCacheRead(uint32_t fileid, uint32_t len, uint32_t offset, uint8_t *buf);
+int cc3000NvCacheWrite(uint32_t fileid, uint32_t len, uint32_t offset, uint8_t *buf);
+void cc3000NvCacheDrop(uint32_t fileid);
+cc3000NvCacheSlot *cc3000NvCacheGet(int32_t fileid);
+void cc3000NvmemCountWrite(uint32_t fileid);
+
+#endif /* __CC3000_NVCACHE__ */
@@ -0,0 +1,96 @@
+/** @file
+ *  @brief Service pack programming with read-back verification.
+ *  @details The patch is handled in #CC3000_PATCH_CHUNK sized chunks. Each
+ *           chunk is read first and left alone if it already matches, so an
+ *           interrupted update resumed with cc3000PatchBlock() only rewrites
+ *           what is left. Chunks that differ go out in the largest portions
+ *           an HCI packet holds and are read back when verification is asked
+ *           for. Called with the global driver semaphore held. */
+
+#include "cc3000_patch.h"
+#include "cc3000_nvcache.h"
+#include "../nvmem.h"
+
+static uint8_t patch_buf[CC3000_PATCH_CHUNK];
+
+cc3000PatchStats cc3000PatchCounters;
+
+/** @brief Clears the counters, at the start of a programming run. */
+void cc3000PatchReset(void) {
+    memset(&cc3000PatchCounters, 0, sizeof(cc3000PatchCounters));
+}
+
+/** @brief Whether @p fileid holds a service pack: the driver, firmware or
+ *         bootloader patch. */
+int cc3000PatchFileValid(int32_t fileid) {
+    return fileid == NVMEM_WLAN_DRIVER_SP_FILEID || fileid == NVMEM_WLAN_FW_SP_FILEID ||
+           fileid == NVMEM_BOOTLOADER_SP_FILEID;
+}
+
+/** @brief Starts a programming run of a @p len bytes image into @p fileid.
+ *  @details Clears the counters and, unless in a dry run, allocates the file
+ *           at the image length with nvmem_create_entry(), as the chip keeps
+ *           the size of the previous service pack otherwise.
+ *  @return 0, or -1 if the entry could not be created. */
+int cc3000PatchStart(uint32_t fileid, uint32_t len, uint32_t flags) {
+    uint32_t start = vosMillis();
+    int ret = 0;
+
+    cc3000PatchReset();
+    if (!(flags & CC3000_PATCH_F_DRYRUN)) {
+        ret = nvmem_create_entry(fileid, len) != 0 ? -1 : 0;
+        if (ret != 0)
+            cc3000PatchCounters.failures++;
+    }
+    cc3000PatchCounters.ms += vosMillis() - start;
+    return ret;
+}
+
+static int patch_chunk(uint32_t fileid, uint32_t offset, uint8_t *data, uint32_t len, uint32_t flags) {
+    if (flags & (CC3000_PATCH_F_SKIP | CC3000_PATCH_F_DRYRUN)) {
+        if (nvmem_read_uncached(fileid, len, offset, patch_buf) != 0)
+            return -1;
+        if (memcmp(patch_buf, data, len) == 0) {
+            cc3000PatchCounters.skipped += len;
+            return 0;
+        }
+    }
+    cc3000PatchCounters.written += len;
+    if (flags & CC3000_PATCH_F_DRYRUN)
+        return 0;
+    if (nvmem_write_uncached(fileid, len, offset, data) != 0)
+        return -1;
+    if (flags & CC3000_PATCH_F_VERIFY) {
+        if (nvmem_read_uncached(fileid, len, offset, patch_buf) != 0 || memcmp(patch_buf, data, len) != 0)
+            return -1;
+        cc3000PatchCounters.verified += len;
+    }
+    return 0;
+}
+
+/** @brief Programs @p len bytes of @p data at @p offset of @p fileid.
+ *  @details A dry run reads and compares the whole block, so it measures the
+ *           read path and tells how much an update would rewrite.
+ *  @return 0, or -1 at the first chunk that fails. */
+int cc3000PatchBlock(uint32_t fileid, uint32_t offset, uint8_t *data, uint32_t len, uint32_t flags) {
+    uint32_t n, start = vosMillis();
+    int ret = 0;
+
+    //a cached copy would hide the new contents from the readers
+    if (!(flags & CC3000_PATCH_F_DRYRUN)) {
+        cc3000NvCacheFlush(fileid, 0);
+        cc3000NvCacheDrop(fileid);
+    }
+    while (ret == 0 && len > 0) {
+        n = (len > CC3000_PATCH_CHUNK) ? CC3000_PATCH_CHUNK : len;
+        ret = patch_chunk(fileid, offset, data, n, flags);
+        cc3000PatchCounters.bytes += n;
+        offset += n;
+        data += n;
+        len -= n;
+    }
+    if (ret != 0)
+        cc3000PatchCounters.failures++;
+    cc3000PatchCounters.ms += vosMillis() - start;
+    return ret;
+}
@@ -0,0 +1,34 @@
+/** @file
+ *  @brief Service pack programming with read-back verification. */
+
+#ifndef __CC3000_PATCH__
+#define __CC3000_PATCH__
+
+#include "viper.h"
+
+/** @brief Comparison granularity: unchanged chunks of this size are not rewritten. */
+#define CC3000_PATCH_CHUNK          (256)
+
+/** @brief cc3000PatchBlock() flags. */
+#define CC3000_PATCH_F_VERIFY       (1)     ///< Read back every written chunk.
+#define CC3000_PATCH_F_SKIP         (2)     ///< Leave chunks that already match untouched.
+#define CC3000_PATCH_F_DRYRUN       (4)     ///< Compare only, never write.
+
+/** @brief Counters of the current programming run, exposed to Python by patch_stats(). */
+typedef struct {
+    uint32_t bytes;         ///< Patch bytes processed.
+    uint32_t written;       ///< Bytes written, or that would be in a dry run.
+    uint32_t skipped;       ///< Bytes found already programmed.
+    uint32_t verified;      ///< Bytes read back after the write.
+    uint32_t failures;      ///< Blocks that failed to read, write or verify.
+    uint32_t ms;            ///< Time spent talking to the chip.
+} cc3000PatchStats;
+
+extern cc3000PatchStats cc3000PatchCounters;
+
+void cc3000PatchReset(void);
+int cc3000PatchFileValid(int32_t fileid);
+int cc3000PatchStart(uint32_t fileid, uint32_t len, uint32_t flags);
+int cc3000PatchBlock(uint32_t fileid, uint32_t offset, uint8_t *data, uint32_t len, uint32_t flags);
+
+#endif /* __CC3000_PATCH__ */
@@ -0,0 +1,119 @@
+/** @file
+ *  @brief Cache of scan results, keyed by BSSID.
+ *  @details Every entry returned by a scan refreshes the access point with
+ *           the same BSSID. Access points not seen for the configured age are
+ *           dropped, and when the table is full the weakest one makes room. */
+
+#include "cc3000_scan.h"
+
+static cc3000ScanEntry scan_cache[CC3000_SCAN_CACHE_SIZE];
+static uint32_t scan_max_age = CC3000_SCAN_DEFAULT_MAX_AGE;
+static uint32_t scan_refreshed = 0;
+static uint8_t scan_complete = 0;
+static VSemaphore scan_lock = NULL;
+
+static int scan_is_stale(cc3000ScanEntry *e, uint32_t now) {
+    return (now - e->seen) >= scan_max_age;
+}
+
+void cc3000ScanCacheInit(void) {
+    if (!scan_lock)
+        scan_lock = vosSemCreate(1);
+    cc3000ScanCacheFlush();
+}
+
+/** @brief Sets how long an access point is kept after it was last seen, in milliseconds. */
+void cc3000ScanCacheConfig(uint32_t max_age) {
+    scan_max_age = max_age;
+}
+
+/** @brief Drops every access point. */
+void cc3000ScanCacheFlush(void) {
+    vosSemWait(scan_lock);
+    memset(scan_cache, 0, sizeof(scan_cache));
+    scan_complete = 0;
+    vosSemSignal(scan_lock);
+}
+
+/** @brief Stores an entry of the results table. */
+void cc3000ScanCacheStore(uint8_t *bssid, uint8_t *ssid, uint32_t ssidlen, uint32_t sec, int32_t rssi) {
+    int i;
+    cc3000ScanEntry *e = NULL;
+    uint32_t now = vosMillis();
+
+    if (ssidlen > sizeof(e->ssid))
+        ssidlen = sizeof(e->ssid);
+    vosSemWait(scan_lock);
+    //the same access point, else a free or stale slot, else the weakest
+    for (i = 0; i < CC3000_SCAN_CACHE_SIZE; i++) {
+        if (scan_cache[i].used && memcmp(scan_cache[i].bssid, bssid, 6) == 0) {
+            e = &scan_cache[i];
+            break;
+        }
+    }
+    for (i = 0; !e && i < CC3000_SCAN_CACHE_SIZE; i++) {
+        if (!scan_cache[i].used || scan_is_stale(&scan_cache[i], now))
+            e = &scan_cache[i];
+    }
+    if (!e) {
+        e = &scan_cache[0];
+        for (i = 1; i < CC3000_SCAN_CACHE_SIZE; i++) {
+            if (scan_cache[i].rssi < e->rssi)
+                e = &scan_cache[i];
+        }
+        if (e->rssi > rssi)
+            e = NULL;
+    }
+    if (e) {
+        e->used = 1;
+        e->sec = sec;
+        e->ssidlen = ssidlen;
+        memcpy(e->bssid, bssid, 6);
+        memcpy(e->ssid, ssid, ssidlen);
+        e->rssi = rssi;
+        e->seen = now;
+    }
+    vosSemSignal(scan_lock);
+}
+
+/** @brief Marks the cache as refreshed by a scan that read the whole table. */
+void cc3000ScanCacheRefreshed(void) {
+    vosSemWait(scan_lock);
+    scan_refreshed = vosMillis();
+    scan_complete = 1;
+    vosSemSignal(scan_lock);
+}
+
+/** @brief Tells if a whole table was read less than @p max_age ms ago. */
+int cc3000ScanCacheFresh(uint32_t max_age) {
+    int ret;
+    vosSemWait(scan_lock);
+    ret = scan_complete && (vosMillis() - scan_refreshed) < max_age;
+    vosSemSignal(scan_lock);
+    return ret;
+}
+
+/** @brief Copies the live access points to @p out, strongest first.
+ *  @details @p out must hold #CC3000_SCAN_CACHE_SIZE entries.
+ *  @return The number of entries copied. */
+int cc3000ScanCacheSnapshot(cc3000ScanEntry *out) {
+    int i, j, n = 0;
+    uint32_t now = vosMillis();
+
+    vosSemWait(scan_lock);
+    for (i = 0; i < CC3000_SCAN_CACHE_SIZE; i++) {
+        if (!scan_cache[i].used)
+            continue;
+        if (scan_is_stale(&scan_cache[i], now)) {
+            scan_cache[i].used = 0;
+            continue;
+        }
+        //insertion sort, the table is small
+        for (j = n; j > 0 && out[j - 1].rssi < scan_cache[i].rssi; j--)
+            out[j] = out[j - 1];
+        out[j] = scan_cache[i];
+        n++;
+    }
+    vosSemSignal(scan_lock);
+    return n;
+}
@@ -0,0 +1,34 @@
+/** @file
+ *  @brief Cache of scan results, keyed by BSSID. */
+
+#ifndef __CC3000_SCAN__
+#define __CC3000_SCAN__
+
+#include "viper.h"
+
+/** @brief Number of access points kept. */
+#define CC3000_SCAN_CACHE_SIZE      (16)
+
+/** @brief Default time an access point is kept after it was last seen, in milliseconds. */
+#define CC3000_SCAN_DEFAULT_MAX_AGE (60000)
+
+/** @brief One access point seen by a scan. */
+typedef struct {
+    uint8_t used;           ///< Slot holds an access point.
+    uint8_t sec;            ///< Security, as reported by the scan.
+    uint8_t ssidlen;        ///< Length of @p ssid.
+    uint8_t bssid[6];       ///< Key of the entry.
+    uint8_t ssid[32];       ///< Network name, not NUL terminated.
+    int32_t rssi;           ///< Last seen signal strength.
+    uint32_t seen;          ///< vosMillis() when last seen.
+} cc3000ScanEntry;
+
+void cc3000ScanCacheInit(void);
+void cc3000ScanCacheConfig(uint32_t max_age);
+void cc3000ScanCacheFlush(void);
+void cc3000ScanCacheStore(uint8_t *bssid, uint8_t *ssid, uint32_t ssidlen, uint32_t sec, int32_t rssi);
+void cc3000ScanCacheRefreshed(void);
+int cc3000ScanCacheFresh(uint32_t max_age);
+int cc3000ScanCacheSnapshot(cc3000ScanEntry *out);
+
+#endif /* __CC3000_SCAN__ */
@@ -1,580 +1,775 @@
-/** @file
-*   @brief     CC3000 SPI driver for ChibiOS/RT.
-*   @details   This bridges TI's CC3000 Host Driver to ChibiOS/RT to
-*              facilitate communications with a CC3000 module.              */
-/*****************************************************************************
-*  Renamed to cc3000_spi.c and adapted for ChibiOS/RT by Alan Barr 2014.
-*
-*  spi.c - CC3000 Host Driver Implementation.
-*  Copyright (C) 2011 Texas Instruments Incorporated - http://www.ti.com/
-*
-*  Redistribution and use in source and binary forms, with or without
-*  modification, are permitted provided that the following conditions
-*  are met:
-*
-*    Redistributions of source code must retain the above copyright
-*    notice, this list of conditions and the following disclaimer.
-*
-*    Redistributions in binary form must reproduce the above copyright
-*    notice, this list of conditions and the following disclaimer in the
-*    documentation and/or other materials provided with the
-*    distribution.
-*
-*    Neither the name of Texas Instruments Incorporated nor the names of
-*    its contributors may be used to endorse or promote products derived
-*    from this software without specific prior written permission.
-*
-*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
-*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
-*  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
-*  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
-*  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
-*  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
-*  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
-*  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-*  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-*  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*
-*****************************************************************************/
-#include "viper.h"
-#include "async_handler.h"
-#include "cc3000_spi.h"
-#include "../hci.h"
-#include "../wlan.h"
-
-//#define printf(...) vbl_printf_stdout(__VA_ARGS__)
-#define printf(...)
-
-
-/* OP Codes for CC3000_SPI_INDEX_OP */
-#define CC3000_SPI_OP_WRITE         1
-#define CC3000_SPI_OP_READ          3
-#define CC3000_SPI_BUSY             0
-
-
-#define HI(value)                       (((value) & 0xFF00) >> 8)
-#define LO(value)                       ((value) & 0x00FF)
-
-#define CC3000_SPI_INDEX_OP         0
-#define CC3000_SPI_INDEX_LEN_MSB    1
-#define CC3000_SPI_INDEX_LEN_LSB    2
-#define CC3000_SPI_INDEX_BUSY_1     3
-#define CC3000_SPI_INDEX_BUSY_2     4
-
-#define CC3000_HEADERS_SIZE_EVNT    (SPI_HEADER_SIZE + 5)
-#define CC3000_SPI_MAGIC_NUMBER     (0xDE)
-#define CC3000_SPI_TX_MAGIC_INDEX   (CC3000_TX_BUFFER_SIZE - 1)
-#define CC3000_SPI_RX_MAGIC_INDEX   (CC3000_RX_BUFFER_SIZE - 1)
-
-#define CC3000_SPI_MIN_READ_B       (10)
-
-
-
-#define SPI_STATE_POWERUP              (0)
-#define SPI_STATE_INITIALIZED          (1)
-#define SPI_STATE_IDLE                 (2)
-#define SPI_STATE_WRITE_REQUESTED      (3)
-#define SPI_STATE_WRITE_PERMITTED      (4)
-#define SPI_STATE_READ_REQUESTED       (5)
-#define SPI_STATE_READ_PERMITTED       (6)
-
-typedef struct {
-    gcSpiHandleRx rxHandlerCb;      ///< Handler function for received data.
-    unsigned short txPacketLength;  ///< Number of bytes to transmit.
-    unsigned short rxPacketLength;  ///< Number of bytes received. (DEBUG)
-    unsigned long spiState;              ///< Current state of the driver.
-    unsigned char *pTxPacket;       ///< Points to data to be transmitted.
-    unsigned char *pRxPacket;       ///< Points to where to store received data.
-} tSpiInformation;
-
-static volatile tSpiInformation spiInformation;
-
-unsigned char wlan_tx_buffer[CC3000_TX_BUFFER_SIZE];
-static unsigned char spi_buffer[CC3000_RX_BUFFER_SIZE];
-
-static const unsigned char spiReadCommand[] = {CC3000_SPI_OP_READ, CC3000_SPI_BUSY, CC3000_SPI_BUSY};
-
-static volatile uint32_t spi_prph;
-static volatile vhalSpiConf spi_conf;
-static volatile uint16_t irqpin;
-static volatile uint16_t wenpin;
-static volatile char ccspi_is_in_irq = 0;
-static volatile char ccspi_int_enabled = 0;
-static volatile uint8_t _write_asked = 0;
-
-
-static VSemaphore irqWriteSem;
-static VSemaphore irqReadSem;
-static VThread *pSignalHandlerThd = NULL;
-
-
-void SpiWriteDataSynchronous(unsigned char *data, unsigned short size);
-void selectCC3000(void);
-void unselectCC3000(void);
-void SpiOpen(gcSpiHandleRx pfRxHandler);
-void SpiClose(void);
-void SpiFirstWrite(unsigned char *pUserBuffer, unsigned short usLength);
-void SpiWrite(unsigned char *pUserBuffer, unsigned short usLength);
-void SpiWriteDataSynchronous(unsigned char *data, unsigned short size);
-void SpiReadDataSynchronous(unsigned char *data, unsigned short size);
-void SpiReadHeader(void);
-void SpiReadAfterHeader(void);
-void SpiPauseSpi(void);
-void SpiResumeSpi(void);
-void SpiTriggerRxProcessing(void);
-void SSIContReadOperation(void);
-
-
-
-void selectCC3000(void) {
-    //int ret;
-   //printf("+selectCC3000 %i\n", spi_prph);
-    vhalSpiLock(spi_prph);
-    vhalSpiInit(spi_prph, &spi_conf);
-    vhalSpiSelect(spi_prph);
-    //printf("-selectCC3000 %i\n", ret);
-
-}
-
-void unselectCC3000(void) {
-   //printf("+unselectCC3000 %i\n", spi_prph);
-    vhalSpiUnselect(spi_prph);
-    vhalSpiDone(spi_prph);
-    vhalSpiUnlock(spi_prph);
-   //printf("-unselectCC3000\n");
-}
-
-
-#define setSpiStateI(x) (spiInformation.spiState = (x))
-void setSpiState(uint32_t x) {
-    vosSysLock();
-    spiInformation.spiState = (x);
-    vosSysUnlock();
-
-}
-#define getSpiState() (spiInformation.spiState)
-
-
-void delay_poll(uint32_t ms) {
-    volatile uint32_t *now = vosTicks();
-    uint32_t time = *now;
-    ms = ms * 1000 * (_system_frequency / 1000000);
-   //printf("waiting %i\n", ms);
-    while (*now - time < ms);
-}
-
-
-
-// void cc3000ExtCb(int slot, int dir) {
-//     (void)slot;
-//     (void)dir;
-
-//     ccspi_is_in_irq = 1;
-
-//    //printf("\tCC3000: Entering SPI_IRQ %i\n\r", getSpiState());
-
-//     if (getSpiState() == SPI_STATE_POWERUP) {
-//         /* IRQ line was low ... perform a callback on the HCI Layer */
-//         setSpiState(SPI_STATE_INITIALIZED);
-//     } else if (getSpiState() == SPI_STATE_IDLE) {
-//         //DEBUGPRINT_F("IDLE\n\r");
-//         setSpiState(SPI_STATE_READ_IRQ);
-
-//         /* IRQ line goes down - start reception */
-
-//         selectCC3000();
-
-//         // Wait for TX/RX Compete which will come as DMA interrupt
-//         SpiReadHeader();
-//         setSpiState(SPI_STATE_READ_EOT);
-//         //DEBUGPRINT_F("SSICont\n\r");
-//         SSIContReadOperation();
-//     }
-//     else if (getSpiState() == SPI_STATE_WRITE_IRQ) {
-//         SpiWriteDataSynchronous(spiInformation.pTxPacket, spiInformation.txPacketLength);
-//         setSpiState(SPI_STATE_IDLE);
-//         unselectCC3000();
-//     }
-
-//    //printf("\tCC3000: Leaving SPI_IRQ %i\n\r", getSpiState());
-
-//     ccspi_is_in_irq = 0;
-// }
-
-
-
-
-void cc3k_int_poll()
-{
-   //printf("cc3k_poll\n");
-    // if (vhalPinRead(irqpin) == 0 && ccspi_is_in_irq == 0 && ccspi_int_enabled != 0) {
-    //    //printf("++cc3k_poll\n");
-    //     cc3000ExtCb(0, 0);
-    // }
-}
-
-void cc3000ExtCb(int slot, int dir) {
-    (void)slot;
-    (void)dir;
-
-    vosSysLockIsr();
-    if (getSpiState() == SPI_STATE_POWERUP) {
-        setSpiStateI(SPI_STATE_INITIALIZED);
-    } else if (getSpiState() == SPI_STATE_IDLE) {
-        setSpiStateI(SPI_STATE_READ_REQUESTED);
-        vosSemSignalIsr(irqReadSem);
-    } else if (getSpiState() == SPI_STATE_WRITE_REQUESTED) {
-        setSpiStateI(SPI_STATE_WRITE_PERMITTED);
-        vosSemSignalIsr(irqWriteSem);
-    } else {
-        //uhh?!?
-    }
-    vosSysUnlockIsr();
-}
-
-
-int irqSignalHandlerThread(void *arg) {
-    (void)arg;
-
-    vhalPinSetMode(D9, PINMODE_OUTPUT_PUSHPULL);
-    vhalPinWrite(D9, 0);
-    while (1) {
-
-        vhalPinWrite(D9, 1);
-        vosSemWait(irqReadSem);
-        vhalPinWrite(D9, 0);
-
-        //state must be read requested
-        if (getSpiState() == SPI_STATE_READ_REQUESTED) {
-            setSpiState(SPI_STATE_READ_PERMITTED);
-
-            selectCC3000();
-            SpiReadHeader();
-            SpiReadAfterHeader();
-            SpiTriggerRxProcessing();
-            setSpiState(SPI_STATE_IDLE);
-            unselectCC3000();
-        }
-
-    }
-
-    return 0;
-}
-
-
-void SpiOpen(gcSpiHandleRx pfRxHandler) {
-
-   //printf("SpiOpen\n");
-    //prepare buffers
-    memset(spi_buffer, 0, CC3000_RX_BUFFER_SIZE);
-    memset(wlan_tx_buffer, 0, CC3000_TX_BUFFER_SIZE);
-    memset((void *)&cc3000AsyncData, 0, sizeof(cc3000AsyncData));
-    spi_buffer[CC3000_SPI_RX_MAGIC_INDEX] = CC3000_SPI_MAGIC_NUMBER;
-    wlan_tx_buffer[CC3000_SPI_TX_MAGIC_INDEX] = CC3000_SPI_MAGIC_NUMBER;
-
-
-    setSpiState(SPI_STATE_POWERUP);
-    spiInformation.rxHandlerCb = pfRxHandler;
-    spiInformation.txPacketLength = 0;
-    spiInformation.pTxPacket = NULL;
-    spiInformation.pRxPacket = (unsigned char *)spi_buffer;
-    spiInformation.rxPacketLength = 0;
-
-    //vhalPinAttachInterrupt(irqpin, PINMODE_EXT_FALLING, cc3000ExtCb);
-
-    tSLInformation.WlanInterruptEnable();
-
-    //delay_poll(100);
-    vosThSleep(TIME_U(100, MILLIS));
-
-}
-
-void SpiClose(void) {
-   //printf("SpiClose\n");
-    if (spiInformation.pRxPacket) {
-        spiInformation.pRxPacket = 0;
-    }
-    tSLInformation.WlanInterruptDisable();
-
-    vhalPinAttachInterrupt(irqpin, 0, NULL,TIME_U(0,MILLIS));
-    vhalSpiDone(spi_prph);
-    vhalSpiUnlock(spi_prph);
-}
-
-
-void SpiFirstWrite(unsigned char *pUserBuffer, unsigned short usLength) {
-   //printf("+SpiFirstWrite\n");
-    selectCC3000();
-    //delay_poll(1);
-    vosThSleep(TIME_U(5, MILLIS));
-
-    SpiWriteDataSynchronous(pUserBuffer, 4);
-
-    //delay_poll(1);
-    vosThSleep(TIME_U(5, MILLIS));
-
-    SpiWriteDataSynchronous(pUserBuffer + 4, usLength - 4);
-
-    setSpiState(SPI_STATE_IDLE);
-
-    unselectCC3000();
-   //printf("-SpiFirstWrite\n");
-
-}
-
-void SpiWrite(unsigned char *pUserBuffer, unsigned short usLength) {
-   //printf("+SpiWrite\n");
-
-    /* If usLength is even, we need to add padding byte */
-    if (!(usLength & 0x01)) {
-        usLength++;
-    }
-
-    /* @todo TI issue: Why can't altering pUserBuffer and usLength be done
-     *       in the host driver? */
-
-    /* Fill in SPI header */
-    pUserBuffer[0] = CC3000_SPI_OP_WRITE;
-    pUserBuffer[1] = HI(usLength);//((usLength) & 0xFF00) >> 8;
-    pUserBuffer[2] = LO(usLength);//((usLength) & 0x00FF);
-    pUserBuffer[3] = CC3000_SPI_BUSY;
-    pUserBuffer[4] = CC3000_SPI_BUSY;
-
-    usLength += SPI_HEADER_SIZE;
-
-    if (wlan_tx_buffer[CC3000_SPI_TX_MAGIC_INDEX] != CC3000_SPI_MAGIC_NUMBER) {
-        //CHIBIOS_CC3000_DBG_PRINT("Buffer overflow detected.", NULL);
-        while (1);
-    }
-
-   //printf("SpiWrite: state1 %i\n", spiInformation.spiState);
-    if (getSpiState() == SPI_STATE_POWERUP) {
-        while (getSpiState() != SPI_STATE_INITIALIZED) {
-            vosThSleep(TIME_U(10, MILLIS));
-        }
-    }
-
-   //printf("SpiWrite: state2 %i\n", spiInformation.spiState);
-    if (getSpiState() == SPI_STATE_INITIALIZED) {
-        SpiFirstWrite(pUserBuffer, usLength);
-    } else {
-
-        vosSysLock();
-        while (getSpiState() != SPI_STATE_IDLE) {
-            vosSysUnlock();
-            vosThSleep(TIME_U(500, MICROS));
-            vosSysLock();
-        }
-        setSpiState(SPI_STATE_WRITE_REQUESTED);
-        vosSysUnlock();
-
-        //can't be a race condition here, since state is WRITE_REQUESTED
-
-        selectCC3000();
-        vosSemWait(irqWriteSem);
-
-        spiInformation.pTxPacket = pUserBuffer;
-        spiInformation.txPacketLength = usLength;
-
-        SpiWriteDataSynchronous(spiInformation.pTxPacket, spiInformation.txPacketLength);
-        setSpiState(SPI_STATE_IDLE);
-        unselectCC3000();
-    }
-
-}
-
-
-void SpiWriteDataSynchronous(unsigned char *data, unsigned short size) {
-    // int i;
-    // for (i = 0; i < size; i++)
-    //    //printf("<< %x\n", data[i]);
-    vhalSpiExchange(spi_prph, (void *)data, NULL, size);
-}
-
-void SpiReadDataSynchronous(unsigned char *data, unsigned short size) {
-    memcpy(data, spiReadCommand, sizeof(spiReadCommand));
-    vhalSpiExchange(spi_prph, (void *)data, (void *)data, size);
-    // for (i = 0; i < size; i++)
-    //    //printf(">> %x\n", data[i]);
-
-    //spiInformation.rxPacketLength += size;
-}
-
-void SpiReadHeader(void) {
-   //printf("ReadHeader\n");
-    SpiReadDataSynchronous(spiInformation.pRxPacket, CC3000_HEADERS_SIZE_EVNT);
-}
-
-
-
-void SpiReadAfterHeader(void) {
-    long data_to_recv = 0;
-    unsigned char *evnt_buff, type;
-   //printf("ReadHeaderAfter\n");
-
-    /* Determine what type of packet we have */
-    evnt_buff =  spiInformation.pRxPacket;
-    STREAM_TO_UINT8((char *)(evnt_buff + SPI_HEADER_SIZE),
-                    HCI_PACKET_TYPE_OFFSET, type);
-
-    switch (type) {
-        case HCI_TYPE_DATA: {
-            /* We need to read the rest of data.. */
-            STREAM_TO_UINT16((char *)(evnt_buff + SPI_HEADER_SIZE), HCI_DATA_LENGTH_OFFSET, data_to_recv);
-
-            if (!((CC3000_HEADERS_SIZE_EVNT + data_to_recv) & 1)) {
-                data_to_recv++;
-            }
-
-            if (data_to_recv) {
-                SpiReadDataSynchronous(evnt_buff + CC3000_HEADERS_SIZE_EVNT, data_to_recv);
-            }
-            break;
-        }
-        case HCI_TYPE_EVNT: {
-            /* Calculate the rest length of the data*/
-            STREAM_TO_UINT8((char *)(evnt_buff + SPI_HEADER_SIZE),
-                            HCI_EVENT_LENGTH_OFFSET, data_to_recv);
-            data_to_recv -= 1;
-
-            /* Add padding byte if needed */
-            if ((CC3000_HEADERS_SIZE_EVNT + data_to_recv) & 1) {
-                data_to_recv++;
-            }
-
-            if (data_to_recv) {
-                SpiReadDataSynchronous(evnt_buff + CC3000_HEADERS_SIZE_EVNT, data_to_recv);
-            }
-            break;
-        }
-    }
-}
-
-
-
-void SpiPauseSpi(void) {
-   //printf("SpiPauseSpi\n");
-    ccspi_int_enabled = 0;
-    //vhalPinAttachInterrupt(irqpin, 0, NULL);
-}
-
-void SpiResumeSpi(void) {
-   //printf("SpiResumeSpi\n");
-    ccspi_int_enabled = 1;
-    //vhalPinAttachInterrupt(irqpin, PINMODE_EXT_FALLING | PINMODE_INPUT_PULLUP, cc3000ExtCb);
-}
-
-
-/** @brief Responsible for calling into TI's host driver with received data. */
-void SpiTriggerRxProcessing(void) {
-   //printf("SpiTriggerRx\n");
-    //SpiPauseSpi();
-
-    /** @todo TI Issue: This is where it is in their example.
-     * Can we not just hold this low, until we are done? i.e. move it until
-     * just before we return from this function? This should mean the CC3000
-     * won't produce another interrupt until we are done processing this one. */
-
-    if (spi_buffer[CC3000_SPI_RX_MAGIC_INDEX] != CC3000_SPI_MAGIC_NUMBER) {
-        //CHIBIOS_CC3000_DBG_PRINT("Buffer overflow detected.", NULL);
-        while (1);
-    }
-    spiInformation.rxHandlerCb(spiInformation.pRxPacket + SPI_HEADER_SIZE);
-
-}
-
-
-
-void SSIContReadOperation(void) {
-   //printf("\tCC3000: SpiContReadOperation\n\r");
-    /* The header was read - continue with  the payload read */
-    SpiReadAfterHeader();
-    SpiTriggerRxProcessing();
-
-}
-
-
-/** @brief Registered callback to wlan_init() to read from IRQ pin.*/
-long ReadWlanInterruptPin(void) {
-    return vhalPinRead(irqpin);//palReadPad(CHIBIOS_CC3000_IRQ_PORT, CHIBIOS_CC3000_IRQ_PAD);
-}
-
-
-/** @brief Registered callback to wlan_init() to write to WLAN EN pin.
- *  @param val Value to set Wlan pin. */
-void WriteWlanPin(unsigned char val) {
-    if (val) {
-        vhalPinWrite(wenpin, 1);
-       //printf("WEN up\n");
-        //palSetPad(CHIBIOS_CC3000_WLAN_EN_PORT, CHIBIOS_CC3000_WLAN_EN_PAD);
-    } else {
-        vhalPinWrite(wenpin, 0);
-       //printf("WEN dn\n");
-        //palClearPad(CHIBIOS_CC3000_WLAN_EN_PORT, CHIBIOS_CC3000_WLAN_EN_PAD);
-    }
-}
-
-
-void WlanInterruptEnable() {
-    //DEBUGPRINT_F("\tCC3000: WlanInterruptEnable.\n\r");
-    // delay(100);
-    ccspi_int_enabled = 1;
-    vhalPinAttachInterrupt(irqpin, PINMODE_EXT_FALLING | PINMODE_INPUT_PULLUP, cc3000ExtCb,TIME_U(0,MILLIS));
-}
-
-void WlanInterruptDisable() {
-    //DEBUGPRINT_F("\tCC3000: WlanInterruptDisable\n\r");
-    ccspi_int_enabled = 0;
-    vhalPinAttachInterrupt(irqpin, 0, NULL,TIME_U(0,MILLIS));
-}
-
-
-int cc3000WlanInit(uint16_t spi_ph, uint16_t nss, uint16_t wen, uint16_t irq) {
-    /* Hold the SPI Driver to be used */
-    int ret;
-    SpiPins *spipins = ((SpiPins*)_vm_pin_map(PRPH_SPI));
-
-    irqpin = irq;
-    wenpin = wen;
-
-    spi_prph = spi_ph;
-
-   //printf("cc3000WlanInit: got spi_prh %i\n", spi_prph);
-    spi_conf.clock = 14000000;
-    spi_conf.miso = spipins[spi_prph].miso;
-    spi_conf.mosi = spipins[spi_prph].mosi;
-    spi_conf.sclk = spipins[spi_prph].sclk;
-    spi_conf.nss = nss;
-    spi_conf.mode = SPI_MODE_LOW_SECOND;
-    spi_conf.bits = SPI_BITS_8;
-    spi_conf.master = 1;
-
-    vhalSpiLock(spi_prph);
-    ret = vhalSpiInit(spi_prph, &spi_conf);
-    vhalSpiUnselect(spi_prph);
-    vhalSpiDone(spi_prph);
-    vhalSpiUnlock(spi_prph);
-
-    if (ret < 0) return -1;
-
-
-    vhalPinSetMode(irqpin, PINMODE_INPUT_PULLUP);
-    vhalPinAttachInterrupt(irqpin, PINMODE_EXT_FALLING | PINMODE_INPUT_PULLUP, cc3000ExtCb,TIME_U(0,MILLIS));
-
-    irqReadSem = vosSemCreate(0);
-    irqWriteSem = vosSemCreate(0);
-    //prio must be as high as vm irqthread, otherwise interrupts are not handled correctly (thread body is not executed with vm_irqthread forever in the hci while -_-)
-    pSignalHandlerThd = vosThCreate(640, VOS_PRIO_HIGHER, irqSignalHandlerThread, NULL, NULL);
-    vosThResume(pSignalHandlerThd);
-
-    vhalPinSetMode(wenpin, PINMODE_OUTPUT_PUSHPULL);
-    WriteWlanPin(0);
-    vosThSleep(TIME_U(1000, MILLIS));
-
-
-
-    wlan_init(CC3000AsyncCb, 0, 0,
-              0, ReadWlanInterruptPin,
-              WlanInterruptEnable, WlanInterruptDisable, WriteWlanPin);
-}
+/** @file
+*   @brief     CC3000 SPI driver for ChibiOS/RT.
+*   @details   This bridges TI's CC3000 Host Driver to ChibiOS/RT to
+*              facilitate communications with a CC3000 module.              */
+/*****************************************************************************
+*  Renamed to cc3000_spi.c and adapted for ChibiOS/RT by Alan Barr 2014.
+*
+*  spi.c - CC3000 Host Driver Implementation.
+*  Copyright (C) 2011 Texas Instruments Incorporated - http://www.ti.com/
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*    Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+*    Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the
+*    distribution.
+*
+*    Neither the name of Texas Instruments Incorporated nor the names of
+*    its contributors may be used to endorse or promote products derived
+*    from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+*  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+*  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+*  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+*  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+*  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+*  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+*  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+*  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+#include "viper.h"
+#include "async_handler.h"
+#include "cc3000_spi.h"
+#include "../hci.h"
+#include "../wlan.h"
+
+//#define printf(...) vbl_printf_stdout(__VA_ARGS__)
+#define printf(...)
+
+
+/* OP Codes for CC3000_SPI_INDEX_OP */
+#define CC3000_SPI_OP_WRITE         1
+#define CC3000_SPI_OP_READ          3
+#define CC3000_SPI_BUSY             0
+
+
+#define HI(value)                       (((value) & 0xFF00) >> 8)
+#define LO(value)                       ((value) & 0x00FF)
+
+#define CC3000_SPI_INDEX_OP         0
+#define CC3000_SPI_INDEX_LEN_MSB    1
+#define CC3000_SPI_INDEX_LEN_LSB    2
+#define CC3000_SPI_INDEX_BUSY_1     3
+#define CC3000_SPI_INDEX_BUSY_2     4
+
+#define CC3000_HEADERS_SIZE_EVNT    (SPI_HEADER_SIZE + 5)
+#define CC3000_SPI_MAGIC_NUMBER     (0xDE)
+#define CC3000_SPI_TX_MAGIC_INDEX   (CC3000_TX_BUFFER_SIZE - 1)
+#define CC3000_SPI_RX_MAGIC_INDEX   (CC3000_RX_BUFFER_SIZE - 1)
+
+#define CC3000_SPI_MIN_READ_B       (10)
+
+/** @brief Most packets read in one wake of the signal thread, so that a
+ *         burst cannot keep a writer off the bus for long. */
+#define CC3000_DRAIN_MAX            (8)
+
+/** @brief How long the signal thread waits, after releasing chip select,
+ *         for the chip to signal the next packet of a burst. */
+#define CC3000_DRAIN_WINDOW_US      (20)
+
+/** @brief Time WLAN_EN is held low to reset the chip in a normal boot. */
+#define CC3000_BOOT_RESET_TIME      (1000)
+
+/** @brief Shortest reset in a fast boot. After it the chip is considered
+ *         off as soon as it releases the irq line. */
+#define CC3000_BOOT_RESET_MIN       (10)
+
+/** @brief Longest wait for the irq of a powering up chip in a fast boot,
+ *         before falling back to polling the line. */
+#define CC3000_BOOT_IRQ_TIMEOUT     (1000)
+
+/** @brief Chip select to data delay of the first write, from the datasheet. */
+#define CC3000_FIRST_WRITE_DELAY_US (50)
+
+
+
+#define SPI_STATE_POWERUP              (0)
+#define SPI_STATE_INITIALIZED          (1)
+#define SPI_STATE_IDLE                 (2)
+#define SPI_STATE_WRITE_REQUESTED      (3)
+#define SPI_STATE_WRITE_PERMITTED      (4)
+#define SPI_STATE_READ_REQUESTED       (5)
+#define SPI_STATE_READ_PERMITTED       (6)
+
+typedef struct {
+    gcSpiHandleRx rxHandlerCb;      ///< Handler function for received data.
+    unsigned short txPacketLength;  ///< Number of bytes to transmit.
+    unsigned short rxPacketLength;  ///< Number of bytes received. (DEBUG)
+    unsigned long spiState;              ///< Current state of the driver.
+    unsigned char *pTxPacket;       ///< Points to data to be transmitted.
+    unsigned char *pRxPacket;       ///< Points to where to store received data.
+} tSpiInformation;
+
+static volatile tSpiInformation spiInformation;
+
+unsigned char wlan_tx_buffer[CC3000_TX_BUFFER_SIZE];
+static unsigned char spi_buffer[CC3000_RX_BUFFER_SIZE];
+
+cc3000SpiStats cc3000SpiCounters;
+
+/** @brief Milliseconds from the start of cc3000WlanInit() to each boot step. */
+uint32_t cc3000BootTimeline[CC3000_BOOT_STEPS];
+
+static const unsigned char spiReadCommand[] = {CC3000_SPI_OP_READ, CC3000_SPI_BUSY, CC3000_SPI_BUSY};
+
+static volatile uint32_t spi_prph;
+static volatile vhalSpiConf spi_conf;
+static volatile uint16_t irqpin;
+static volatile uint16_t wenpin;
+static volatile char ccspi_is_in_irq = 0;
+static volatile char ccspi_int_enabled = 0;
+static volatile uint8_t _write_asked = 0;
+
+
+static VSemaphore irqWriteSem;
+static VSemaphore irqReadSem;
+static VSemaphore idleSem;
+static VSemaphore bootSem;
+static volatile uint8_t fastBoot = 0;
+static uint32_t bootStart;
+static volatile uint32_t idleWaiters = 0;
+static VThread *pSignalHandlerThd = NULL;
+
+
+void SpiWriteDataSynchronous(unsigned char *data, unsigned short size);
+void selectCC3000(void);
+void unselectCC3000(void);
+void SpiOpen(gcSpiHandleRx pfRxHandler);
+void SpiClose(void);
+void SpiFirstWrite(unsigned char *pUserBuffer, unsigned short usLength);
+void SpiWrite(unsigned char *pUserBuffer, unsigned short usLength);
+void SpiWriteDataSynchronous(unsigned char *data, unsigned short size);
+void SpiReadDataSynchronous(unsigned char *data, unsigned short size);
+void SpiReadHeader(void);
+void SpiReadAfterHeader(void);
+void SpiPauseSpi(void);
+void SpiResumeSpi(void);
+void SpiTriggerRxProcessing(void);
+void SSIContReadOperation(void);
+
+
+
+void selectCC3000(void) {
+    //int ret;
+   //printf("+selectCC3000 %i\n", spi_prph);
+    vhalSpiLock(spi_prph);
+    vhalSpiInit(spi_prph, &spi_conf);
+    vhalSpiSelect(spi_prph);
+    //printf("-selectCC3000 %i\n", ret);
+
+}
+
+void unselectCC3000(void) {
+   //printf("+unselectCC3000 %i\n", spi_prph);
+    vhalSpiUnselect(spi_prph);
+    vhalSpiDone(spi_prph);
+    vhalSpiUnlock(spi_prph);
+   //printf("-unselectCC3000\n");
+}
+
+
+/* The SPI state is only changed by compare-and-swap transitions, so the
+ * isr and the threads never mask interrupts to agree on it. Cores with
+ * LDREX/STREX get inline atomics; Cortex-M0 has no exclusive access, the
+ * builtins would become library calls there, and a short system lock
+ * stands in for them. */
+#if defined(__ARM_ARCH_6M__)
+static int casSpiState(uint32_t from, uint32_t to) {
+    int ok;
+    vosSysLock();
+    ok = spiInformation.spiState == from;
+    if (ok)
+        spiInformation.spiState = to;
+    vosSysUnlock();
+    return ok;
+}
+
+/** @brief casSpiState() for the isr. */
+static int casSpiStateIsr(uint32_t from, uint32_t to) {
+    int ok;
+    vosSysLockIsr();
+    ok = spiInformation.spiState == from;
+    if (ok)
+        spiInformation.spiState = to;
+    vosSysUnlockIsr();
+    return ok;
+}
+
+static void addIdleWaiters(int32_t n) {
+    vosSysLock();
+    idleWaiters += n;
+    vosSysUnlock();
+}
+
+void setSpiState(uint32_t x) {
+    vosSysLock();
+    spiInformation.spiState = (x);
+    vosSysUnlock();
+}
+#else
+static int casSpiState(uint32_t from, uint32_t to) {
+    unsigned long expected = from;
+    return __atomic_compare_exchange_n(&spiInformation.spiState, &expected, (unsigned long)to,
+                                       0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+#define casSpiStateIsr(from, to) casSpiState((from), (to))
+
+static void addIdleWaiters(int32_t n) {
+    __atomic_fetch_add(&idleWaiters, n, __ATOMIC_SEQ_CST);
+}
+
+void setSpiState(uint32_t x) {
+    __atomic_store_n(&spiInformation.spiState, (unsigned long)x, __ATOMIC_SEQ_CST);
+}
+#endif
+#define getSpiState() (*(volatile unsigned long *)&spiInformation.spiState)
+
+/** @brief Records the time of boot @p step, only the first time it is reached. */
+void cc3000BootMark(int step) {
+    if (cc3000BootTimeline[step] == CC3000_BOOT_UNREACHED)
+        cc3000BootTimeline[step] = vosMillis() - bootStart;
+}
+
+/** @brief Returns the bus to idle and wakes a writer waiting for it. */
+void setSpiIdle(void) {
+    setSpiState(SPI_STATE_IDLE);
+    if (idleWaiters)
+        vosSemSignal(idleSem);
+}
+
+/** @brief Moves the state from idle to write requested, sleeping until the
+ *         transfer in progress ends. */
+void claimSpiForWrite(void) {
+    while (!casSpiState(SPI_STATE_IDLE, SPI_STATE_WRITE_REQUESTED)) {
+        addIdleWaiters(1);
+        //re-check after registering, or a setSpiIdle() in between is missed
+        if (getSpiState() != SPI_STATE_IDLE)
+            vosSemWait(idleSem);
+        addIdleWaiters(-1);
+    }
+}
+
+
+void delay_poll(uint32_t ms) {
+    volatile uint32_t *now = vosTicks();
+    uint32_t time = *now;
+    ms = ms * 1000 * (_system_frequency / 1000000);
+   //printf("waiting %i\n", ms);
+    while (*now - time < ms);
+}
+
+
+
+// void cc3000ExtCb(int slot, int dir) {
+//     (void)slot;
+//     (void)dir;
+
+//     ccspi_is_in_irq = 1;
+
+//    //printf("\tCC3000: Entering SPI_IRQ %i\n\r", getSpiState());
+
+//     if (getSpiState() == SPI_STATE_POWERUP) {
+//         /* IRQ line was low ... perform a callback on the HCI Layer */
+//         setSpiState(SPI_STATE_INITIALIZED);
+//     } else if (getSpiState() == SPI_STATE_IDLE) {
+//         //DEBUGPRINT_F("IDLE\n\r");
+//         setSpiState(SPI_STATE_READ_IRQ);
+
+//         /* IRQ line goes down - start reception */
+
+//         selectCC3000();
+
+//         // Wait for TX/RX Compete which will come as DMA interrupt
+//         SpiReadHeader();
+//         setSpiState(SPI_STATE_READ_EOT);
+//         //DEBUGPRINT_F("SSICont\n\r");
+//         SSIContReadOperation();
+//     }
+//     else if (getSpiState() == SPI_STATE_WRITE_IRQ) {
+//         SpiWriteDataSynchronous(spiInformation.pTxPacket, spiInformation.txPacketLength);
+//         setSpiState(SPI_STATE_IDLE);
+//         unselectCC3000();
+//     }
+
+//    //printf("\tCC3000: Leaving SPI_IRQ %i\n\r", getSpiState());
+
+//     ccspi_is_in_irq = 0;
+// }
+
+
+
+
+void cc3k_int_poll()
+{
+   //printf("cc3k_poll\n");
+    // if (vhalPinRead(irqpin) == 0 && ccspi_is_in_irq == 0 && ccspi_int_enabled != 0) {
+    //    //printf("++cc3k_poll\n");
+    //     cc3000ExtCb(0, 0);
+    // }
+}
+
+void cc3000ExtCb(int slot, int dir) {
+    (void)slot;
+    (void)dir;
+
+    if (casSpiStateIsr(SPI_STATE_POWERUP, SPI_STATE_INITIALIZED)) {
+        //first irq after power up
+        cc3000BootMark(CC3000_BOOT_IRQ);
+        vosSysLockIsr();
+        vosSemSignalIsr(bootSem);
+        vosSysUnlockIsr();
+    } else if (casSpiStateIsr(SPI_STATE_IDLE, SPI_STATE_READ_REQUESTED)) {
+        vosSysLockIsr();
+        vosSemSignalIsr(irqReadSem);
+        vosSysUnlockIsr();
+    } else if (casSpiStateIsr(SPI_STATE_WRITE_REQUESTED, SPI_STATE_WRITE_PERMITTED)) {
+        vosSysLockIsr();
+        vosSemSignalIsr(irqWriteSem);
+        vosSysUnlockIsr();
+    } else {
+        //uhh?!?
+    }
+}
+
+
+/** @brief Spins for up to #CC3000_DRAIN_WINDOW_US waiting for the irq of
+ *         the next packet.
+ *  @return 1 if a read was requested, 0 if the line stayed quiet or a
+ *          writer took over. */
+static int cc3000ReadPending(void) {
+    volatile uint32_t *now = vosTicks();
+    uint32_t start = *now;
+    uint32_t window = CC3000_DRAIN_WINDOW_US * (_system_frequency / 1000000);
+
+    do {
+        if (getSpiState() == SPI_STATE_READ_REQUESTED)
+            return 1;
+        if (getSpiState() != SPI_STATE_IDLE)
+            return 0;
+    } while (*now - start < window);
+    return 0;
+}
+
+int irqSignalHandlerThread(void *arg) {
+    (void)arg;
+    uint32_t drained;
+
+    vhalPinSetMode(D9, PINMODE_OUTPUT_PUSHPULL);
+    vhalPinWrite(D9, 0);
+    while (1) {
+
+        vhalPinWrite(D9, 1);
+        vosSemWait(irqReadSem);
+        vhalPinWrite(D9, 0);
+
+        //state must be read requested
+        if (!casSpiState(SPI_STATE_READ_REQUESTED, SPI_STATE_READ_PERMITTED))
+            continue;
+
+        //the chip wants chip select released after every packet, but the
+        //bus can stay locked and configured for the whole burst
+        vhalSpiLock(spi_prph);
+        vhalSpiInit(spi_prph, &spi_conf);
+        drained = 0;
+        while (1) {
+            vhalSpiSelect(spi_prph);
+            SpiReadHeader();
+            SpiReadAfterHeader();
+            cc3000SpiCounters.rx_packets++;
+            SpiTriggerRxProcessing();
+            //idle before unselect, or the irq of the next packet finds the
+            //state still busy and is lost
+            setSpiIdle();
+            vhalSpiUnselect(spi_prph);
+            drained++;
+
+            //a solicited packet stays in spi_buffer until the waiting thread
+            //parses it in hci_event_handler(): reading the next one would overwrite it
+            if (drained >= CC3000_DRAIN_MAX || tSLInformation.usEventOrDataReceived != 0 ||
+                    !cc3000ReadPending())
+                break;
+            //the isr signalled the semaphore for this packet: consume it here
+            vosSemWaitTimeout(irqReadSem, VTIME_IMMEDIATE);
+            setSpiState(SPI_STATE_READ_PERMITTED);
+        }
+        vhalSpiDone(spi_prph);
+        vhalSpiUnlock(spi_prph);
+
+        cc3000SpiCounters.wakes++;
+        if (drained > cc3000SpiCounters.max_burst)
+            cc3000SpiCounters.max_burst = drained;
+    }
+
+    return 0;
+}
+
+
+void SpiOpen(gcSpiHandleRx pfRxHandler) {
+
+   //printf("SpiOpen\n");
+    //prepare buffers
+    memset(spi_buffer, 0, CC3000_RX_BUFFER_SIZE);
+    memset(wlan_tx_buffer, 0, CC3000_TX_BUFFER_SIZE);
+    memset((void *)&cc3000AsyncData, 0, sizeof(cc3000AsyncData));
+    spi_buffer[CC3000_SPI_RX_MAGIC_INDEX] = CC3000_SPI_MAGIC_NUMBER;
+    wlan_tx_buffer[CC3000_SPI_TX_MAGIC_INDEX] = CC3000_SPI_MAGIC_NUMBER;
+
+
+    setSpiState(SPI_STATE_POWERUP);
+    spiInformation.rxHandlerCb = pfRxHandler;
+    spiInformation.txPacketLength = 0;
+    spiInformation.pTxPacket = NULL;
+    spiInformation.pRxPacket = (unsigned char *)spi_buffer;
+    spiInformation.rxPacketLength = 0;
+
+    //vhalPinAttachInterrupt(irqpin, PINMODE_EXT_FALLING, cc3000ExtCb);
+
+    tSLInformation.WlanInterruptEnable();
+
+    //delay_poll(100);
+    if (!fastBoot)
+        vosThSleep(TIME_U(100, MILLIS));
+    cc3000BootMark(CC3000_BOOT_SPI_OPEN);
+}
+
+/** @brief Sleeps until the chip pulls irq low after WLAN_EN is raised,
+ *         instead of the busy wait of wlan_start().
+ *  @return 1 once the chip is up, 0 when not in fast boot or when the irq
+ *          did not come in time: the caller then polls the line. */
+int SpiWaitPowerUp(void) {
+    uint32_t start = vosMillis();
+    uint32_t elapsed;
+
+    if (!fastBoot)
+        return 0;
+    //a semaphore count left from an earlier boot is told apart by the state
+    while (getSpiState() == SPI_STATE_POWERUP) {
+        elapsed = vosMillis() - start;
+        if (elapsed >= CC3000_BOOT_IRQ_TIMEOUT)
+            return 0;
+        vosSemWaitTimeout(bootSem, TIME_U(CC3000_BOOT_IRQ_TIMEOUT - elapsed, MILLIS));
+    }
+    return 1;
+}
+
+void SpiClose(void) {
+   //printf("SpiClose\n");
+    if (spiInformation.pRxPacket) {
+        spiInformation.pRxPacket = 0;
+    }
+    tSLInformation.WlanInterruptDisable();
+
+    vhalPinAttachInterrupt(irqpin, 0, NULL,TIME_U(0,MILLIS));
+    vhalSpiDone(spi_prph);
+    vhalSpiUnlock(spi_prph);
+}
+
+
+void SpiFirstWrite(unsigned char *pUserBuffer, unsigned short usLength) {
+   //printf("+SpiFirstWrite\n");
+    selectCC3000();
+    //delay_poll(1);
+    if (fastBoot)
+        vosThSleep(TIME_U(CC3000_FIRST_WRITE_DELAY_US, MICROS));
+    else
+        vosThSleep(TIME_U(5, MILLIS));
+
+    SpiWriteDataSynchronous(pUserBuffer, 4);
+
+    //delay_poll(1);
+    if (fastBoot)
+        vosThSleep(TIME_U(CC3000_FIRST_WRITE_DELAY_US, MICROS));
+    else
+        vosThSleep(TIME_U(5, MILLIS));
+
+    SpiWriteDataSynchronous(pUserBuffer + 4, usLength - 4);
+
+    setSpiIdle();
+    cc3000BootMark(CC3000_BOOT_FIRST_WRITE);
+
+    unselectCC3000();
+   //printf("-SpiFirstWrite\n");
+
+}
+
+void SpiWrite(unsigned char *pUserBuffer, unsigned short usLength) {
+   //printf("+SpiWrite\n");
+
+    /* If usLength is even, we need to add padding byte */
+    if (!(usLength & 0x01)) {
+        usLength++;
+    }
+
+    /* @todo TI issue: Why can't altering pUserBuffer and usLength be done
+     *       in the host driver? */
+
+    /* Fill in SPI header */
+    pUserBuffer[0] = CC3000_SPI_OP_WRITE;
+    pUserBuffer[1] = HI(usLength);//((usLength) & 0xFF00) >> 8;
+    pUserBuffer[2] = LO(usLength);//((usLength) & 0x00FF);
+    pUserBuffer[3] = CC3000_SPI_BUSY;
+    pUserBuffer[4] = CC3000_SPI_BUSY;
+
+    usLength += SPI_HEADER_SIZE;
+
+    if (wlan_tx_buffer[CC3000_SPI_TX_MAGIC_INDEX] != CC3000_SPI_MAGIC_NUMBER) {
+        //CHIBIOS_CC3000_DBG_PRINT("Buffer overflow detected.", NULL);
+        while (1);
+    }
+
+   //printf("SpiWrite: state1 %i\n", spiInformation.spiState);
+    if (getSpiState() == SPI_STATE_POWERUP) {
+        while (getSpiState() != SPI_STATE_INITIALIZED) {
+            vosThSleep(TIME_U(10, MILLIS));
+        }
+    }
+
+   //printf("SpiWrite: state2 %i\n", spiInformation.spiState);
+    if (getSpiState() == SPI_STATE_INITIALIZED) {
+        SpiFirstWrite(pUserBuffer, usLength);
+    } else {
+
+        claimSpiForWrite();
+
+        //can't be a race condition here, since state is WRITE_REQUESTED
+
+        selectCC3000();
+        vosSemWait(irqWriteSem);
+
+        spiInformation.pTxPacket = pUserBuffer;
+        spiInformation.txPacketLength = usLength;
+
+        SpiWriteDataSynchronous(spiInformation.pTxPacket, spiInformation.txPacketLength);
+        setSpiIdle();
+        unselectCC3000();
+    }
+
+}
+
+
+void SpiWriteDataSynchronous(unsigned char *data, unsigned short size) {
+    // int i;
+    // for (i = 0; i < size; i++)
+    //    //printf("<< %x\n", data[i]);
+    vhalSpiExchange(spi_prph, (void *)data, NULL, size);
+}
+
+void SpiReadDataSynchronous(unsigned char *data, unsigned short size) {
+    memcpy(data, spiReadCommand, sizeof(spiReadCommand));
+    vhalSpiExchange(spi_prph, (void *)data, (void *)data, size);
+    // for (i = 0; i < size; i++)
+    //    //printf(">> %x\n", data[i]);
+
+    cc3000SpiCounters.rx_bytes += size;
+}
+
+void SpiReadHeader(void) {
+   //printf("ReadHeader\n");
+    SpiReadDataSynchronous(spiInformation.pRxPacket, CC3000_HEADERS_SIZE_EVNT);
+}
+
+
+
+void SpiReadAfterHeader(void) {
+    long data_to_recv = 0;
+    unsigned char *evnt_buff, type;
+   //printf("ReadHeaderAfter\n");
+
+    /* Determine what type of packet we have */
+    evnt_buff =  spiInformation.pRxPacket;
+    STREAM_TO_UINT8((char *)(evnt_buff + SPI_HEADER_SIZE),
+                    HCI_PACKET_TYPE_OFFSET, type);
+
+    switch (type) {
+        case HCI_TYPE_DATA: {
+            /* We need to read the rest of data.. */
+            STREAM_TO_UINT16((char *)(evnt_buff + SPI_HEADER_SIZE), HCI_DATA_LENGTH_OFFSET, data_to_recv);
+
+            if (!((CC3000_HEADERS_SIZE_EVNT + data_to_recv) & 1)) {
+                data_to_recv++;
+            }
+
+            if (data_to_recv) {
+                SpiReadDataSynchronous(evnt_buff + CC3000_HEADERS_SIZE_EVNT, data_to_recv);
+            }
+            break;
+        }
+        case HCI_TYPE_EVNT: {
+            /* Calculate the rest length of the data*/
+            STREAM_TO_UINT8((char *)(evnt_buff + SPI_HEADER_SIZE),
+                            HCI_EVENT_LENGTH_OFFSET, data_to_recv);
+            data_to_recv -= 1;
+
+            /* Add padding byte if needed */
+            if ((CC3000_HEADERS_SIZE_EVNT + data_to_recv) & 1) {
+                data_to_recv++;
+            }
+
+            if (data_to_recv) {
+                SpiReadDataSynchronous(evnt_buff + CC3000_HEADERS_SIZE_EVNT, data_to_recv);
+            }
+            break;
+        }
+    }
+}
+
+
+
+void SpiPauseSpi(void) {
+   //printf("SpiPauseSpi\n");
+    ccspi_int_enabled = 0;
+    //vhalPinAttachInterrupt(irqpin, 0, NULL);
+}
+
+void SpiResumeSpi(void) {
+   //printf("SpiResumeSpi\n");
+    ccspi_int_enabled = 1;
+    //vhalPinAttachInterrupt(irqpin, PINMODE_EXT_FALLING | PINMODE_INPUT_PULLUP, cc3000ExtCb);
+}
+
+
+/** @brief Responsible for calling into TI's host driver with received data. */
+void SpiTriggerRxProcessing(void) {
+   //printf("SpiTriggerRx\n");
+    //SpiPauseSpi();
+
+    /** @todo TI Issue: This is where it is in their example.
+     * Can we not just hold this low, until we are done? i.e. move it until
+     * just before we return from this function? This should mean the CC3000
+     * won't produce another interrupt until we are done processing this one. */
+
+    if (spi_buffer[CC3000_SPI_RX_MAGIC_INDEX] != CC3000_SPI_MAGIC_NUMBER) {
+        //CHIBIOS_CC3000_DBG_PRINT("Buffer overflow detected.", NULL);
+        while (1);
+    }
+    spiInformation.rxHandlerCb(spiInformation.pRxPacket + SPI_HEADER_SIZE);
+
+}
+
+
+
+void SSIContReadOperation(void) {
+   //printf("\tCC3000: SpiContReadOperation\n\r");
+    /* The header was read - continue with  the payload read */
+    SpiReadAfterHeader();
+    SpiTriggerRxProcessing();
+
+}
+
+
+/** @brief Registered callback to wlan_init() to read from IRQ pin.*/
+long ReadWlanInterruptPin(void) {
+    return vhalPinRead(irqpin);//palReadPad(CHIBIOS_CC3000_IRQ_PORT, CHIBIOS_CC3000_IRQ_PAD);
+}
+
+
+/** @brief Registered callback to wlan_init() to write to WLAN EN pin.
+ *  @param val Value to set Wlan pin. */
+void WriteWlanPin(unsigned char val) {
+    if (val) {
+        vhalPinWrite(wenpin, 1);
+        cc3000BootMark(CC3000_BOOT_ENABLE);
+       //printf("WEN up\n");
+        //palSetPad(CHIBIOS_CC3000_WLAN_EN_PORT, CHIBIOS_CC3000_WLAN_EN_PAD);
+    } else {
+        vhalPinWrite(wenpin, 0);
+       //printf("WEN dn\n");
+        //palClearPad(CHIBIOS_CC3000_WLAN_EN_PORT, CHIBIOS_CC3000_WLAN_EN_PAD);
+    }
+}
+
+
+void WlanInterruptEnable() {
+    //DEBUGPRINT_F("\tCC3000: WlanInterruptEnable.\n\r");
+    // delay(100);
+    ccspi_int_enabled = 1;
+    vhalPinAttachInterrupt(irqpin, PINMODE_EXT_FALLING | PINMODE_INPUT_PULLUP, cc3000ExtCb,TIME_U(0,MILLIS));
+}
+
+void WlanInterruptDisable() {
+    //DEBUGPRINT_F("\tCC3000: WlanInterruptDisable\n\r");
+    ccspi_int_enabled = 0;
+    vhalPinAttachInterrupt(irqpin, 0, NULL,TIME_U(0,MILLIS));
+}
+
+
+/** @brief Brings up the SPI link and resets the chip.
+ *  @param fast_boot Replace the fixed bring-up delays with irq waits bounded
+ *                   by the datasheet minimums. */
+int cc3000WlanInit(uint16_t spi_ph, uint16_t nss, uint16_t wen, uint16_t irq, uint8_t fast_boot) {
+    /* Hold the SPI Driver to be used */
+    int ret;
+    int i;
+    SpiPins *spipins = ((SpiPins*)_vm_pin_map(PRPH_SPI));
+
+    bootStart = vosMillis();
+    for (i = 0; i < CC3000_BOOT_STEPS; i++)
+        cc3000BootTimeline[i] = CC3000_BOOT_UNREACHED;
+    cc3000BootTimeline[CC3000_BOOT_START] = 0;
+    fastBoot = fast_boot;
+
+    irqpin = irq;
+    wenpin = wen;
+
+    spi_prph = spi_ph;
+
+   //printf("cc3000WlanInit: got spi_prh %i\n", spi_prph);
+    spi_conf.clock = 14000000;
+    spi_conf.miso = spipins[spi_prph].miso;
+    spi_conf.mosi = spipins[spi_prph].mosi;
+    spi_conf.sclk = spipins[spi_prph].sclk;
+    spi_conf.nss = nss;
+    spi_conf.mode = SPI_MODE_LOW_SECOND;
+    spi_conf.bits = SPI_BITS_8;
+    spi_conf.master = 1;
+
+    vhalSpiLock(spi_prph);
+    ret = vhalSpiInit(spi_prph, &spi_conf);
+    vhalSpiUnselect(spi_prph);
+    vhalSpiDone(spi_prph);
+    vhalSpiUnlock(spi_prph);
+
+    if (ret < 0) return -1;
+
+
+    //the isr signals these: create them before attaching it
+    irqReadSem = vosSemCreate(0);
+    irqWriteSem = vosSemCreate(0);
+    idleSem = vosSemCreate(0);
+    bootSem = vosSemCreate(0);
+
+    vhalPinSetMode(irqpin, PINMODE_INPUT_PULLUP);
+    vhalPinAttachInterrupt(irqpin, PINMODE_EXT_FALLING | PINMODE_INPUT_PULLUP, cc3000ExtCb,TIME_U(0,MILLIS));
+    //prio must be as high as vm irqthread, otherwise interrupts are not handled correctly (thread body is not executed with vm_irqthread forever in the hci while -_-)
+    pSignalHandlerThd = vosThCreate(640, VOS_PRIO_HIGHER, irqSignalHandlerThread, NULL, NULL);
+    vosThResume(pSignalHandlerThd);
+
+    vhalPinSetMode(wenpin, PINMODE_OUTPUT_PUSHPULL);
+    WriteWlanPin(0);
+    if (fastBoot) {
+        //a chip in reset releases the irq line
+        vosThSleep(TIME_U(CC3000_BOOT_RESET_MIN, MILLIS));
+        while (!ReadWlanInterruptPin() && vosMillis() - bootStart < CC3000_BOOT_RESET_TIME)
+            vosThSleep(TIME_U(1, MILLIS));
+    } else {
+        vosThSleep(TIME_U(CC3000_BOOT_RESET_TIME, MILLIS));
+    }
+    cc3000BootMark(CC3000_BOOT_RESET);
+
+
+
+    wlan_init(CC3000AsyncCb, 0, 0,
+              0, ReadWlanInterruptPin,
+              WlanInterruptEnable, WlanInterruptDisable, WriteWlanPin);
+    return 0;
+}
@@ -1,59 +1,87 @@
-/** @file
-*   @brief     Header file to allow the CC3000HostDriver to use SPI functions.
-*   @details   Needed by the CC3000HostDriver.                              */
-/*****************************************************************************
-*  Renamed to cc3000_spi.h and adapted for ChibiOS/RT by Alan Barr 2014.
-*
-*  spi.h  - CC3000 Host Driver Implementation.
-*  Copyright (C) 2011 Texas Instruments Incorporated - http://www.ti.com/
-*
-*  Redistribution and use in source and binary forms, with or without
-*  modification, are permitted provided that the following conditions
-*  are met:
-*
-*    Redistributions of source code must retain the above copyright
-*    notice, this list of conditions and the following disclaimer.
-*
-*    Redistributions in binary form must reproduce the above copyright
-*    notice, this list of conditions and the following disclaimer in the
-*    documentation and/or other materials provided with the
-*    distribution.
-*
-*    Neither the name of Texas Instruments Incorporated nor the names of
-*    its contributors may be used to endorse or promote products derived
-*    from this software without specific prior written permission.
-*
-*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
-*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
-*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
-*  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
-*  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
-*  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
-*  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
-*  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
-*  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-*  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-*  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-*
-*****************************************************************************/
-
-#ifndef __CHIBIOS_CC3000_SPI_H__
-#define __CHIBIOS_CC3000_SPI_H__
-
-#include "../cc3000_common.h"
-
-/** @brief Function pointer to a function for processing received SPI data.
- *  @details This function is registered in #SpiOpen() and will be registered
- *  (in host driver 1.11.1) to SpiReceiveHandler() in wlan.c. */
-typedef void (*gcSpiHandleRx)(void *p);
-
-void SpiOpen(gcSpiHandleRx pfRxHandler);
-void SpiClose(void);
-void SpiWrite(unsigned char *pUserBuffer, unsigned short usLength);
-
-void SpiResumeSpi(void);
-
-extern unsigned char wlan_tx_buffer[CC3000_TX_BUFFER_SIZE];
-
-#endif /*__CHIBIOS_CC3000_SPI_H__*/
-
+/** @file
+*   @brief     Header file to allow the CC3000HostDriver to use SPI functions.
+*   @details   Needed by the CC3000HostDriver.                              */
+/*****************************************************************************
+*  Renamed to cc3000_spi.h and adapted for ChibiOS/RT by Alan Barr 2014.
+*
+*  spi.h  - CC3000 Host Driver Implementation.
+*  Copyright (C) 2011 Texas Instruments Incorporated - http://www.ti.com/
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*    Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+*    Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the
+*    distribution.
+*
+*    Neither the name of Texas Instruments Incorporated nor the names of
+*    its contributors may be used to endorse or promote products derived
+*    from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+*  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+*  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+*  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+*  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+*  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+*  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+*  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+*  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+#ifndef __CHIBIOS_CC3000_SPI_H__
+#define __CHIBIOS_CC3000_SPI_H__
+
+#include "../cc3000_common.h"
+
+/** @brief Function pointer to a function for processing received SPI data.
+ *  @details This function is registered in #SpiOpen() and will be registered
+ *  (in host driver 1.11.1) to SpiReceiveHandler() in wlan.c. */
+typedef void (*gcSpiHandleRx)(void *p);
+
+void SpiOpen(gcSpiHandleRx pfRxHandler);
+void SpiClose(void);
+void SpiWrite(unsigned char *pUserBuffer, unsigned short usLength);
+
+void SpiResumeSpi(void);
+
+/** @brief SPI traffic counters, exposed to Python by event_stats(). */
+typedef struct {
+    uint32_t rx_packets;    ///< Events and data packets read from the chip.
+    uint32_t rx_bytes;      ///< Bytes clocked in, SPI header and padding included.
+    uint32_t wakes;         ///< Wakes of the signal thread that read packets.
+    uint32_t max_burst;     ///< Most packets drained in a single wake.
+} cc3000SpiStats;
+
+extern cc3000SpiStats cc3000SpiCounters;
+
+/** @brief Steps of the boot timeline, exposed to Python by boot_timeline(). */
+#define CC3000_BOOT_START           (0)     ///< cc3000WlanInit() called, WLAN_EN lowered.
+#define CC3000_BOOT_RESET           (1)     ///< Chip reset done.
+#define CC3000_BOOT_SPI_OPEN        (2)     ///< SpiOpen() done, irq enabled.
+#define CC3000_BOOT_ENABLE          (3)     ///< WLAN_EN raised.
+#define CC3000_BOOT_IRQ             (4)     ///< Chip pulled irq low, ready for the first write.
+#define CC3000_BOOT_FIRST_WRITE     (5)     ///< First write sent.
+#define CC3000_BOOT_STARTED         (6)     ///< wlan_start() returned.
+#define CC3000_BOOT_READY           (7)     ///< cc3000_init() done.
+#define CC3000_BOOT_STEPS           (8)
+
+/** @brief Timeline value of a step not reached yet. */
+#define CC3000_BOOT_UNREACHED       (0xFFFFFFFF)
+
+extern uint32_t cc3000BootTimeline[CC3000_BOOT_STEPS];
+
+void cc3000BootMark(int step);
+
+extern unsigned char wlan_tx_buffer[CC3000_TX_BUFFER_SIZE];
+
+#endif /*__CHIBIOS_CC3000_SPI_H__*/
+